@@ -0,0 +1,161 @@
+// compare.cpp: Laura Galbraith
+// Description: compares benchmark results for The Advent Of Code 2021 solvers built in different configurations
+// Usage: bench_compare.out NAME=FILE [NAME=FILE ...]
+//   Each FILE is the JSON written by "bench.out --json FILE" for the configuration called NAME; the first is the baseline
+// For each day, adds up the median times of parsing and each part, and reports how many times faster each configuration is than the baseline
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdlib>
+
+using namespace std;
+
+class ConfigResults {
+  public:
+    string name;
+    map<string, double> day_ms; // sum of the phases' median times, by day
+    map<string, bool> day_failed;
+};
+
+// JSONField returns the value of the named field in one line of bench.out's JSON, without any quotes, or "" if it is not there
+// bench.out writes each result on its own line, so a full JSON parser is not needed
+string JSONField(const string& line, const string& field) {
+  const string key = "\"" + field + "\": ";
+  size_t start = line.find(key);
+  if (start == string::npos) {
+    return "";
+  }
+  start += key.size();
+
+  if (line[start] == '"') {
+    ++start;
+    return line.substr(start, line.find('"', start) - start);
+  }
+  return line.substr(start, line.find_first_of(",}", start) - start);
+}
+
+// ReadResults reads one configuration's results into config, keeping the days in the order they first appear
+// Returns 0 on success, or -1 if the file cannot be read
+int ReadResults(const string& file_name, ConfigResults& config, vector<string>& days) {
+  ifstream file(file_name);
+  if (!file.is_open()) {
+    return -1;
+  }
+
+  string line;
+  while (getline(file, line)) {
+    const string day = JSONField(line, "day");
+    if (day == "") {
+      continue;
+    }
+
+    if (config.day_ms.count(day) == 0) {
+      config.day_ms[day] = 0;
+      config.day_failed[day] = false;
+      bool seen = false;
+      for (auto d:days) {
+        seen = seen || d == day;
+      }
+      if (!seen) {
+        days.push_back(day);
+      }
+    }
+    config.day_ms[day] += atof(JSONField(line, "median_ms").c_str());
+    config.day_failed[day] = config.day_failed[day] || JSONField(line, "status") != "0";
+  }
+  return 0;
+}
+
+// Cell formats one configuration's time for a day, followed by its speedup over the baseline unless it is the baseline
+string Cell(const ConfigResults& config, const ConfigResults& baseline, const string& day, const bool is_baseline) {
+  ostringstream os;
+  os << fixed << setprecision(3);
+  auto found = config.day_ms.find(day);
+  if (found == config.day_ms.end()) {
+    os << setw(12) << "-";
+    if (!is_baseline) { os << setw(10) << "-"; }
+    return os.str();
+  }
+
+  os << setw(12) << found->second;
+  if (!is_baseline) {
+    auto base = baseline.day_ms.find(day);
+    if (base == baseline.day_ms.end() || found->second <= 0) {
+      os << setw(10) << "-";
+    }
+    else {
+      os << setw(9) << setprecision(2) << base->second / found->second << "x";
+    }
+  }
+  if (config.day_failed.count(day) > 0 && config.day_failed.at(day)) {
+    os << "!";
+  }
+  return os.str();
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    cout << "Usage: " << argv[0] << " NAME=FILE [NAME=FILE ...]" << endl;
+    return -1;
+  }
+
+  vector<ConfigResults> configs;
+  vector<string> days;
+  for (int a = 1; a < argc; ++a) {
+    string arg = argv[a];
+    size_t equals = arg.find('=');
+    if (equals == string::npos || equals == 0) {
+      cout << "Usage: " << argv[0] << " NAME=FILE [NAME=FILE ...]" << endl;
+      return -1;
+    }
+
+    ConfigResults config;
+    config.name = arg.substr(0, equals);
+    if (ReadResults(arg.substr(equals + 1), config, days) < 0) {
+      cout << "Failed to read benchmark results: " << arg.substr(equals + 1) << endl;
+      return -1;
+    }
+    configs.push_back(config);
+  }
+
+  // The total row only counts days present in every configuration, so the speedups compare the same work
+  for (auto& config:configs) {
+    double total = 0;
+    for (auto day:days) {
+      bool in_all = true;
+      for (auto& other:configs) {
+        in_all = in_all && other.day_ms.count(day) > 0;
+      }
+      if (in_all) {
+        total += config.day_ms[day];
+      }
+    }
+    config.day_ms["total"] = total;
+  }
+
+  cout << left << setw(7) << "day" << right;
+  for (int c = 0; c < configs.size(); ++c) {
+    cout << setw(12) << configs[c].name + " ms";
+    if (c > 0) {
+      cout << setw(10) << "speedup";
+    }
+  }
+  cout << endl;
+
+  days.push_back("total");
+  for (auto day:days) {
+    cout << left << setw(7) << day << right;
+    for (int c = 0; c < configs.size(); ++c) {
+      cout << Cell(configs[c], configs[0], day, c == 0);
+    }
+    cout << endl;
+  }
+
+  cout << "Times are the sum of the median times of parsing and each part; ! marks a day whose solver reported failure" << endl;
+  return 0;
+}
@@ -0,0 +1,141 @@
+// day15.cpp: Laura Galbraith
+// Description: benchmark of the path-finding strategies for Day 15 of The Advent Of Code 2021, on random risk maps of growing size
+// Usage: bench_day15.out [--runs N] [--seed N] [--grow N] [--node-map-limit N] [--threads N,N,...] [SIDE ...]
+//   Each SIDE is the width and height of a square map of random risk levels; by default the sides double from 100 up to 3200
+//   With --grow, each map is searched tiled that many times in each direction, as in Part 2 (default 1: just the map)
+//   The original node-map search is only timed on full maps with sides up to --node-map-limit (default 400), since it is far slower
+//   Parallel delta-stepping is timed with each thread count given, to see how it scales (default 1,2,4,8,16,32)
+// For each map and strategy, reports the fastest of the runs, and checks that every strategy finds the same lowest total risk
+
+#include "../day15/solver.hpp" // LowestTotalRisk, SearchStrategy
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <random>
+#include <sstream>
+#include <cstdlib>
+
+using namespace std;
+
+const unsigned long long int kDefaultSeed = 2021;
+
+// RandomRiskMap returns a side-by-side map of risk levels from 1 to 9
+vector<vector<int>> RandomRiskMap(const int side, mt19937_64& random) {
+  vector<vector<int>> risk_map(side, vector<int>(side));
+  for (int row = 0; row < side; ++row) {
+    for (int col = 0; col < side; ++col) {
+      risk_map[row][col] = 1 + random() % 9;
+    }
+  }
+  return risk_map;
+}
+
+// TimeStrategy returns the fastest time in milliseconds over the runs, and sets risk to the answer found
+double TimeStrategy(const vector<vector<int>>& risk_map, const int grow_factor, const day15::SearchStrategy strategy, const unsigned int threads, const int runs, int& risk) {
+  double fastest_ms = -1;
+  for (int r = 0; r < runs; ++r) {
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    risk = day15::LowestTotalRisk(risk_map, grow_factor, strategy, threads);
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    if (fastest_ms < 0 || ms < fastest_ms) {
+      fastest_ms = ms;
+    }
+  }
+  return fastest_ms;
+}
+
+int main(int argc, char** argv) {
+  int runs = 3;
+  unsigned long long int seed = kDefaultSeed;
+  int node_map_limit = 400;
+  int grow_factor = 1;
+  vector<int> sides;
+  vector<unsigned int> thread_counts;
+
+  for (int a = 1; a < argc; ++a) {
+    string arg = argv[a];
+    if (arg == "--runs" && a + 1 < argc) {
+      runs = atoi(argv[++a]);
+    }
+    else if (arg == "--seed" && a + 1 < argc) {
+      seed = strtoull(argv[++a], NULL, 10);
+    }
+    else if (arg == "--grow" && a + 1 < argc) {
+      grow_factor = atoi(argv[++a]);
+    }
+    else if (arg == "--threads" && a + 1 < argc) {
+      istringstream counts(argv[++a]);
+      string count;
+      while (getline(counts, count, ',')) {
+        if (atoi(count.c_str()) > 0) {
+          thread_counts.push_back(atoi(count.c_str()));
+        }
+      }
+    }
+    else if (arg == "--node-map-limit" && a + 1 < argc) {
+      node_map_limit = atoi(argv[++a]);
+    }
+    else if (!arg.empty() && arg.find_first_not_of("0123456789") == string::npos && atoi(arg.c_str()) > 0) {
+      sides.push_back(atoi(arg.c_str()));
+    }
+    else {
+      cout << "Usage: " << argv[0] << " [--runs N] [--seed N] [--grow N] [--node-map-limit N] [--threads N,N,...] [SIDE ...]" << endl;
+      return -1;
+    }
+  }
+  if (runs <= 0 || grow_factor <= 0) {
+    cout << "Number of runs and grow factor must be positive" << endl;
+    return -1;
+  }
+  if (sides.empty()) {
+    for (int side = 100; side <= 3200; side *= 2) {
+      sides.push_back(side);
+    }
+  }
+  if (thread_counts.empty()) {
+    for (unsigned int threads = 1; threads <= 32; threads *= 2) {
+      thread_counts.push_back(threads);
+    }
+  }
+
+  // Each run is a strategy, with the number of threads it gets (which only matters for delta-stepping)
+  vector<day15::SearchStrategy> strategies = { day15::SearchStrategy::node_map, day15::SearchStrategy::grid_heap, day15::SearchStrategy::grid_buckets };
+  vector<unsigned int> strategy_threads = { 1, 1, 1 };
+  vector<string> strategy_names = { "node_map", "grid_heap", "grid_buckets" };
+  for (auto threads:thread_counts) {
+    strategies.push_back(day15::SearchStrategy::parallel_delta_stepping);
+    strategy_threads.push_back(threads);
+    strategy_names.push_back("delta_step x" + to_string(threads));
+  }
+
+  cout << left << setw(8) << "side" << setw(12) << "cells" << setw(18) << "strategy" << right
+    << setw(12) << "risk" << setw(14) << "fastest ms" << setw(16) << "vs grid_heap" << endl;
+
+  mt19937_64 random(seed);
+  int status = 0;
+  for (auto side:sides) {
+    const vector<vector<int>> risk_map = RandomRiskMap(side, random);
+
+    int heap_risk = -1;
+    double heap_ms = TimeStrategy(risk_map, grow_factor, day15::SearchStrategy::grid_heap, 1, runs, heap_risk);
+    for (int s = 0; s < strategies.size(); ++s) {
+      if (strategies[s] == day15::SearchStrategy::node_map && (long long int)side * grow_factor > node_map_limit) {
+        continue;
+      }
+
+      int risk = heap_risk;
+      double ms = strategies[s] == day15::SearchStrategy::grid_heap ? heap_ms : TimeStrategy(risk_map, grow_factor, strategies[s], strategy_threads[s], runs, risk);
+      const long long int full_side = (long long int)side * grow_factor;
+      cout << left << setw(8) << side << setw(12) << full_side * full_side << setw(18) << strategy_names[s] << right
+        << fixed << setprecision(3) << setw(12) << risk << setw(14) << ms << setw(15) << heap_ms / ms << "x"
+        << (risk != heap_risk ? "  (answer differs from grid_heap)" : "") << endl;
+      if (risk != heap_risk) {
+        status = -1;
+      }
+    }
+  }
+
+  return status;
+}
@@ -0,0 +1,193 @@
+// day23.cpp: Laura Galbraith
+// Description: benchmark of the search strategies for Day 23 of The Advent Of Code 2021, on burrow diagrams
+// Usage: bench_day23.out [--runs N] [--seed N] [--threads N,N,...] [--random ROOMSxDEPTH ...] [DIAGRAM_FILE ...]
+//   Each DIAGRAM_FILE is searched as it is; by default, day23/input.txt is searched both folded and unfolded, as in Parts 1 and 2
+//   Each --random adds a burrow of that shape with its amphipods shuffled, e.g. '--random 6x4' for six types of amphipod, four of each
+//   Parallel HDA* is timed with each thread count given, to see how it scales (default 1,2,4,8)
+// For each diagram and strategy, reports the fastest of the runs, and checks that every strategy finds the same least energy
+
+#include "../day23/solver.hpp" // LeastEnergyToOrganize, SearchStrategy, UnfoldDiagram
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <cstdlib>
+#include <cstdio>
+
+using namespace std;
+
+const unsigned long long int kDefaultSeed = 2021;
+
+// ReadDiagram returns the lines of the file, or throws if it cannot be read
+vector<string> ReadDiagram(const string& path) {
+  ifstream file(path);
+  if (!file) {
+    throw invalid_argument("could not open " + path);
+  }
+
+  vector<string> diagram;
+  string line;
+  while (getline(file, line)) {
+    diagram.push_back(line);
+  }
+  return diagram;
+}
+
+// RandomDiagram returns a diagram of a burrow with the given number of rooms, each depth deep, under a hallway two cells longer than them at each end,
+// with depth amphipods of each type shuffled into the rooms (but not already organized)
+vector<string> RandomDiagram(const int rooms, const int depth, mt19937_64& random) {
+  string organized;
+  for (int slot = 0; slot < depth; ++slot) {
+    for (int room = 0; room < rooms; ++room) {
+      organized.push_back('A' + room);
+    }
+  }
+  string amphipods = organized;
+  while (amphipods == organized) {
+    shuffle(amphipods.begin(), amphipods.end(), random);
+  }
+
+  const int width = 2 * rooms + 5;
+  vector<string> diagram;
+  diagram.push_back(string(width, '#'));
+  diagram.push_back("#" + string(width - 2, '.') + "#");
+  for (int slot = 0; slot < depth; ++slot) {
+    string line = slot == 0 ? string(width, '#') : "  " + string(2 * rooms + 1, '#');
+    for (int room = 0; room < rooms; ++room) {
+      line[3 + 2 * room] = amphipods[slot * rooms + room];
+    }
+    diagram.push_back(line);
+  }
+  diagram.push_back("  " + string(2 * rooms + 1, '#'));
+  return diagram;
+}
+
+// TimeStrategy returns the fastest time in milliseconds over the runs, and sets energy to the answer found
+double TimeStrategy(const vector<string>& diagram, const day23::SearchStrategy strategy, const unsigned int threads, const int runs, int& energy) {
+  double fastest_ms = -1;
+  for (int r = 0; r < runs; ++r) {
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    energy = day23::LeastEnergyToOrganize(diagram, strategy, threads);
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    if (fastest_ms < 0 || ms < fastest_ms) {
+      fastest_ms = ms;
+    }
+  }
+  return fastest_ms;
+}
+
+int main(int argc, char** argv) {
+  int runs = 3;
+  unsigned long long int seed = kDefaultSeed;
+  vector<string> paths;
+  vector<pair<int,int>> random_shapes; // rooms and depth
+  vector<unsigned int> thread_counts;
+
+  int rooms = 0, depth = 0;
+  for (int a = 1; a < argc; ++a) {
+    string arg = argv[a];
+    if (arg == "--runs" && a + 1 < argc) {
+      runs = atoi(argv[++a]);
+    }
+    else if (arg == "--seed" && a + 1 < argc) {
+      seed = strtoull(argv[++a], NULL, 10);
+    }
+    else if (arg == "--random" && a + 1 < argc && sscanf(argv[a+1], "%dx%d", &rooms, &depth) == 2 && rooms > 0 && depth > 0) {
+      random_shapes.push_back(make_pair(rooms, depth));
+      ++a;
+    }
+    else if (arg == "--threads" && a + 1 < argc) {
+      istringstream counts(argv[++a]);
+      string count;
+      while (getline(counts, count, ',')) {
+        if (atoi(count.c_str()) > 0) {
+          thread_counts.push_back(atoi(count.c_str()));
+        }
+      }
+    }
+    else if (!arg.empty() && arg[0] != '-') {
+      paths.push_back(arg);
+    }
+    else {
+      cout << "Usage: " << argv[0] << " [--runs N] [--seed N] [--threads N,N,...] [--random ROOMSxDEPTH ...] [DIAGRAM_FILE ...]" << endl;
+      return -1;
+    }
+  }
+  if (runs <= 0) {
+    cout << "Number of runs must be positive" << endl;
+    return -1;
+  }
+  if (thread_counts.empty()) {
+    for (unsigned int threads = 1; threads <= 8; threads *= 2) {
+      thread_counts.push_back(threads);
+    }
+  }
+
+  // Each diagram is named for the file it came from, or its shape if it is random
+  vector<vector<string>> diagrams;
+  vector<string> diagram_names;
+  mt19937_64 random(seed);
+  for (auto shape:random_shapes) {
+    diagrams.push_back(RandomDiagram(shape.first, shape.second, random));
+    diagram_names.push_back("random " + to_string(shape.first) + "x" + to_string(shape.second));
+  }
+  try {
+    if (paths.empty() && random_shapes.empty()) {
+      diagrams.push_back(ReadDiagram("day23/input.txt"));
+      diagram_names.push_back("input");
+      diagrams.push_back(day23::UnfoldDiagram(diagrams.back()));
+      diagram_names.push_back("input unfolded");
+    }
+    for (auto path:paths) {
+      diagrams.push_back(ReadDiagram(path));
+      diagram_names.push_back(path);
+    }
+  }
+  catch (const exception& e) {
+    cout << "Failed to read diagram: " << e.what() << endl;
+    return -1;
+  }
+
+  // Each run is a strategy, with the number of threads it gets (which only matters for HDA*)
+  vector<day23::SearchStrategy> strategies = { day23::SearchStrategy::astar };
+  vector<unsigned int> strategy_threads = { 1 };
+  vector<string> strategy_names = { "astar" };
+  for (auto threads:thread_counts) {
+    strategies.push_back(day23::SearchStrategy::parallel_hda_star);
+    strategy_threads.push_back(threads);
+    strategy_names.push_back("hda_star x" + to_string(threads));
+  }
+
+  cout << left << setw(24) << "diagram" << setw(16) << "strategy" << right
+    << setw(12) << "energy" << setw(14) << "fastest ms" << setw(14) << "vs astar" << endl;
+
+  int status = 0;
+  for (int d = 0; d < diagrams.size(); ++d) {
+    try {
+      int astar_energy = -1;
+      double astar_ms = TimeStrategy(diagrams[d], day23::SearchStrategy::astar, 1, runs, astar_energy);
+      for (int s = 0; s < strategies.size(); ++s) {
+        int energy = astar_energy;
+        double ms = strategies[s] == day23::SearchStrategy::astar ? astar_ms : TimeStrategy(diagrams[d], strategies[s], strategy_threads[s], runs, energy);
+        cout << left << setw(24) << diagram_names[d] << setw(16) << strategy_names[s] << right
+          << fixed << setprecision(3) << setw(12) << energy << setw(14) << ms << setw(13) << astar_ms / ms << "x"
+          << (energy != astar_energy ? "  (answer differs from astar)" : "") << endl;
+        if (energy != astar_energy) {
+          status = -1;
+        }
+      }
+    }
+    catch (const exception& e) {
+      cout << left << setw(24) << diagram_names[d] << "failed: " << e.what() << endl;
+      status = -1;
+    }
+  }
+
+  return status;
+}
@@ -0,0 +1,231 @@
+// day24.cpp: Laura Galbraith
+// Description: benchmark of the search strategies for Day 24 of The Advent Of Code 2021, on MONAD programs
+// Usage: bench_day24.out [--runs N] [--threads N,N,...] [--state-frontier] [PROGRAM_FILE ...]
+//   Each PROGRAM_FILE is searched for both its largest and smallest model numbers; by default, day24/input-modified.txt is, since every strategy takes it
+//   Parallel frontier is timed with each thread count given, to see how it scales (default 1,2,4,8)
+//   The state frontier takes minutes on the puzzle input, so it is only timed with --state-frontier
+// For each program and strategy, reports the fastest of the runs, and checks that every strategy finds the same model numbers as block analysis
+// First, checks block analysis against every model number of a small program whose blocks are not MONAD's, so it must search them unpruned
+
+#include "../day24/solver.hpp" // ValidModelNumbers, SearchStrategy, ModelNumberRange
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <sstream>
+#include <stdexcept>
+#include <cstdlib>
+#include <map>
+#include <algorithm>
+
+using namespace std;
+
+// ReadProgram returns the lines of the file, or throws if it cannot be read
+vector<string> ReadProgram(const string& path) {
+  ifstream file(path);
+  if (!file) {
+    throw invalid_argument("could not open " + path);
+  }
+
+  vector<string> program;
+  string line;
+  while (getline(file, line)) {
+    program.push_back(line);
+  }
+  return program;
+}
+
+// kUnshapedProgram reads four digits, but not as MONAD does: z only ever grows until the last digit, which is valid if it is z mod 7
+const vector<string> kUnshapedProgram = {
+  "inp w", "add z w", "mul z 3",
+  "inp w", "add z w", "mul z 3",
+  "inp w", "add z w",
+  "inp w", "mul x 0", "add x z", "mod x 7", "eql x w", "eql x 0", "mul z 0", "add z x"
+};
+
+// RunProgram returns z after running the program on the digits, with a plain ALU that knows nothing of blocks
+long long int RunProgram(const vector<string>& program, const string& digits) {
+  map<string, long long int> variables = {{"w", 0}, {"x", 0}, {"y", 0}, {"z", 0}};
+  size_t next_digit = 0;
+  for (auto line:program) {
+    istringstream words(line);
+    string operation, a, b;
+    words >> operation >> a >> b;
+    if (operation == "inp") {
+      variables[a] = digits[next_digit++] - '0';
+      continue;
+    }
+    const long long int value = variables.count(b) != 0 ? variables[b] : atoll(b.c_str());
+    if (operation == "add") {
+      variables[a] += value;
+    }
+    else if (operation == "mul") {
+      variables[a] *= value;
+    }
+    else if (operation == "div") {
+      variables[a] /= value;
+    }
+    else if (operation == "mod") {
+      variables[a] %= value;
+    }
+    else if (operation == "eql") {
+      variables[a] = variables[a] == value ? 1 : 0;
+    }
+  }
+  return variables["z"];
+}
+
+// BruteForceModelNumbers runs the program on every model number with the given count of digits, and returns the largest and smallest that are valid
+day24::ModelNumberRange BruteForceModelNumbers(const vector<string>& program, const int digit_count) {
+  day24::ModelNumberRange range = {0, 0};
+  string digits(digit_count, '1');
+  while (true) {
+    if (RunProgram(program, digits) == 0) {
+      const long long int model_number = atoll(digits.c_str());
+      range.largest = max(range.largest, model_number);
+      range.smallest = range.smallest == 0 ? model_number : min(range.smallest, model_number);
+    }
+    int d = digit_count - 1;
+    while (d >= 0 && digits[d] == '9') {
+      digits[d--] = '1';
+    }
+    if (d < 0) {
+      return range;
+    }
+    ++digits[d];
+  }
+}
+
+// TimeStrategy returns the fastest time in milliseconds over the runs, and sets range to the model numbers found
+double TimeStrategy(const vector<string>& program, const day24::SearchStrategy strategy, const unsigned int threads, const int runs,
+                    day24::ModelNumberRange& range) {
+  double fastest_ms = -1;
+  for (int r = 0; r < runs; ++r) {
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    range = day24::ValidModelNumbers(program, strategy, threads);
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    if (fastest_ms < 0 || ms < fastest_ms) {
+      fastest_ms = ms;
+    }
+  }
+  return fastest_ms;
+}
+
+int main(int argc, char** argv) {
+  int runs = 3;
+  bool time_state_frontier = false;
+  vector<string> paths;
+  vector<unsigned int> thread_counts;
+
+  for (int a = 1; a < argc; ++a) {
+    string arg = argv[a];
+    if (arg == "--runs" && a + 1 < argc) {
+      runs = atoi(argv[++a]);
+    }
+    else if (arg == "--state-frontier") {
+      time_state_frontier = true;
+    }
+    else if (arg == "--threads" && a + 1 < argc) {
+      istringstream counts(argv[++a]);
+      string count;
+      while (getline(counts, count, ',')) {
+        if (atoi(count.c_str()) > 0) {
+          thread_counts.push_back(atoi(count.c_str()));
+        }
+      }
+    }
+    else if (!arg.empty() && arg[0] != '-') {
+      paths.push_back(arg);
+    }
+    else {
+      cout << "Usage: " << argv[0] << " [--runs N] [--threads N,N,...] [--state-frontier] [PROGRAM_FILE ...]" << endl;
+      return -1;
+    }
+  }
+  if (runs <= 0) {
+    cout << "Number of runs must be positive" << endl;
+    return -1;
+  }
+  if (thread_counts.empty()) {
+    for (unsigned int threads = 1; threads <= 8; threads *= 2) {
+      thread_counts.push_back(threads);
+    }
+  }
+  if (paths.empty()) {
+    paths.push_back("day24/input-modified.txt");
+  }
+
+  vector<vector<string>> programs;
+  try {
+    for (auto path:paths) {
+      programs.push_back(ReadProgram(path));
+    }
+  }
+  catch (const exception& e) {
+    cout << "Failed to read program: " << e.what() << endl;
+    return -1;
+  }
+
+  // Each run is a strategy, with the number of threads it gets (which only matters for the parallel frontier)
+  vector<day24::SearchStrategy> strategies = { day24::SearchStrategy::block_analysis };
+  vector<unsigned int> strategy_threads = { 1 };
+  vector<string> strategy_names = { "block_analysis" };
+  if (time_state_frontier) {
+    strategies.push_back(day24::SearchStrategy::state_frontier);
+    strategy_threads.push_back(1);
+    strategy_names.push_back("state_frontier");
+  }
+  strategies.push_back(day24::SearchStrategy::batched_frontier);
+  strategy_threads.push_back(1);
+  strategy_names.push_back("batched_frontier");
+  for (auto threads:thread_counts) {
+    strategies.push_back(day24::SearchStrategy::parallel_frontier);
+    strategy_threads.push_back(threads);
+    strategy_names.push_back("parallel x" + to_string(threads));
+  }
+
+  // Block analysis only skips z values that cannot be brought down to 0 when the program is MONAD's, so it must find every answer of one that is not
+  int status = 0;
+  try {
+    const day24::ModelNumberRange expected = BruteForceModelNumbers(kUnshapedProgram, 4);
+    const day24::ModelNumberRange found = day24::ValidModelNumbers(kUnshapedProgram, day24::SearchStrategy::block_analysis);
+    if (found.largest != expected.largest || found.smallest != expected.smallest) {
+      cout << "block_analysis found " << found.largest << " and " << found.smallest << " on a program not in MONAD's form, instead of "
+        << expected.largest << " and " << expected.smallest << endl;
+      status = -1;
+    }
+  }
+  catch (const exception& e) {
+    cout << "block_analysis failed on a program not in MONAD's form: " << e.what() << endl;
+    status = -1;
+  }
+
+  cout << left << setw(28) << "program" << setw(20) << "strategy" << right
+    << setw(18) << "largest" << setw(18) << "smallest" << setw(14) << "fastest ms" << setw(14) << "vs blocks" << endl;
+
+  for (int p = 0; p < programs.size(); ++p) {
+    try {
+      day24::ModelNumberRange blocks_range;
+      double blocks_ms = TimeStrategy(programs[p], day24::SearchStrategy::block_analysis, 1, runs, blocks_range);
+      for (int s = 0; s < strategies.size(); ++s) {
+        day24::ModelNumberRange range = blocks_range;
+        double ms = strategies[s] == day24::SearchStrategy::block_analysis ? blocks_ms : TimeStrategy(programs[p], strategies[s], strategy_threads[s], runs, range);
+        const bool differs = range.largest != blocks_range.largest || range.smallest != blocks_range.smallest;
+        cout << left << setw(28) << paths[p] << setw(20) << strategy_names[s] << right
+          << fixed << setprecision(3) << setw(18) << range.largest << setw(18) << range.smallest << setw(14) << ms << setw(13) << blocks_ms / ms << "x"
+          << (differs ? "  (answer differs from block_analysis)" : "") << endl;
+        if (differs) {
+          status = -1;
+        }
+      }
+    }
+    catch (const exception& e) {
+      cout << left << setw(28) << paths[p] << "failed: " << e.what() << endl;
+      status = -1;
+    }
+  }
+
+  return status;
+}
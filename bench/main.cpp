@@ -0,0 +1,291 @@
+// main.cpp: Laura Galbraith
+// Description: benchmark harness that runs the solvers for The Advent Of Code 2021 in-process and reports their cost
+// Usage: bench.out [--runs N] [--warmup N] [--json FILE] [--skip-slow] [--input-dir DIR] [dayNN ...]
+//   Must be run from the repo root, since every day's default input is found relative to it (like "dayNN/input.txt")
+//   With --input-dir, a day reads DIR/dayNN.txt instead when that file exists (for example, inputs written by gen.out)
+//   With no days listed, every day is run
+// Each run uses a new solver, and times parsing the input and each part separately; the input file is read once per day, outside the timing
+// For each day and phase, reports min/median/p99 wall time over the measured runs, the peak RSS while the phase ran, and allocations per run
+// When built with AOC_INSTRUMENT (build/instrument/bench.out), each day is followed by its instrumentation over the measured runs
+// Allocations are counted by util/allocnew.cpp, which bench.out links; when built with AOC_ALLOCPROF (build/allocprof/bench.out),
+// each day is also followed by its allocation profile over the measured runs, by phase, size, and call site
+
+#include "../util/registry.hpp" // AllSolvers
+#include "../util/fileutil.hpp" // MappedFile
+#include "../util/instrument.hpp" // instrument::Reset, instrument::Report
+#include "../util/allocprof.hpp" // AllocationCount, AllocatedBytes, ScopedPhase
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <malloc.h> // malloc_trim
+
+using namespace std;
+
+// ResetPeakRSS asks the kernel to restart tracking the peak resident set size from the current size
+// Freed heap memory is handed back first, so one phase's peak does not carry over into the next one's
+// Returns false if the kernel does not support it, in which case peaks are for the whole process lifetime
+bool ResetPeakRSS() {
+  malloc_trim(0);
+
+  ofstream clear_refs("/proc/self/clear_refs");
+  if (!clear_refs.is_open()) {
+    return false;
+  }
+  clear_refs << "5";
+  return clear_refs.good();
+}
+
+// PeakRSSKilobytes returns the peak resident set size (VmHWM) of this process, or -1 if it cannot be read
+long long int PeakRSSKilobytes() {
+  ifstream status("/proc/self/status");
+  string line;
+  while (getline(status, line)) {
+    if (line.compare(0, 6, "VmHWM:") == 0) {
+      return stoll(line.substr(6));
+    }
+  }
+  return -1;
+}
+
+class BenchResult {
+  public:
+    string day;
+    string part; // "parse", "1", or "2"
+    vector<double> run_ms; // sorted ascending once all runs are done
+    long long int peak_rss_kb; // highest over the measured runs
+    unsigned long long int allocations_per_run;
+    unsigned long long int allocated_bytes_per_run;
+    int status; // 0 if every run succeeded
+
+    BenchResult(const string& d, const string& p): day(d), part(p), peak_rss_kb(-1), allocations_per_run(0), allocated_bytes_per_run(0), status(0) {}
+
+    // Percentile returns the nearest-rank percentile of the run times
+    double Percentile(const double p) const {
+      if (this->run_ms.empty()) { return 0; }
+      int rank = (int)(p / 100.0 * this->run_ms.size() + 0.999999) - 1;
+      rank = rank < 0 ? 0 : rank;
+      rank = rank >= (int)this->run_ms.size() ? this->run_ms.size() - 1 : rank;
+      return this->run_ms[rank];
+    }
+};
+
+// PhaseMeasurement collects the cost of one phase of one run into result; it measures nothing if result is NULL
+class PhaseMeasurement {
+  private:
+    BenchResult* result;
+    unsigned long long int allocations_before;
+    unsigned long long int bytes_before;
+    chrono::steady_clock::time_point start;
+
+  public:
+    // Resetting the peak RSS is not free, so it is done before the clock starts
+    explicit PhaseMeasurement(BenchResult* r): result(r), allocations_before(0), bytes_before(0) {
+      if (this->result == NULL) { return; }
+      ResetPeakRSS();
+      this->allocations_before = allocprof::AllocationCount();
+      this->bytes_before = allocprof::AllocatedBytes();
+      this->start = chrono::steady_clock::now();
+    }
+
+    void Finish() {
+      if (this->result == NULL) { return; }
+      chrono::steady_clock::time_point end = chrono::steady_clock::now();
+      this->result->run_ms.push_back(chrono::duration<double, milli>(end - this->start).count());
+      this->result->allocations_per_run += allocprof::AllocationCount() - this->allocations_before;
+      this->result->allocated_bytes_per_run += allocprof::AllocatedBytes() - this->bytes_before;
+      this->result->peak_rss_kb = max(this->result->peak_rss_kb, PeakRSSKilobytes());
+    }
+};
+
+// RunOnce parses the input with a new solver and solves every part, adding each phase's cost to results if measure is true
+// results holds the parse phase first, then each part in order
+// Returns 0 on success, or -1 if the solver failed
+int RunOnce(const SolverEntry& day, const vector<LineView>& lines, vector<BenchResult>& results, const bool measure) {
+  PuzzleSolver* solver = day.create();
+  int status = 0;
+  try {
+    {
+      allocprof::ScopedPhase phase(allocprof::Phase::parse);
+      PhaseMeasurement parse(measure ? &results[0] : NULL);
+      solver->Parse(lines);
+      parse.Finish();
+    }
+
+    for (int part = 1; part <= solver->PartCount(); ++part) {
+      allocprof::ScopedPhase phase(part == 1 ? allocprof::Phase::part1 : allocprof::Phase::part2);
+      PhaseMeasurement solve(measure ? &results[part] : NULL);
+      string answer = part == 1 ? solver->Part1() : solver->Part2();
+      solve.Finish();
+    }
+  }
+  catch (const exception& e) {
+    cerr << day.name << " failed: " << e.what() << endl;
+    status = -1;
+  }
+
+  delete solver;
+  return status;
+}
+
+vector<BenchResult> RunBenchmark(const SolverEntry& day, const string& input_file, const int runs, const int warmup) {
+  vector<BenchResult> results;
+  results.push_back(BenchResult(day.name, "parse"));
+
+  PuzzleSolver* probe = day.create();
+  for (int part = 1; part <= probe->PartCount(); ++part) {
+    results.push_back(BenchResult(day.name, to_string(part)));
+  }
+  delete probe;
+
+  MappedFile file(input_file);
+  if (file.Status() != FileStatus::ok) {
+    for (int i = 0; i < results.size(); ++i) {
+      results[i].status = -1;
+    }
+    return results;
+  }
+
+  int status = 0;
+  for (int w = 0; w < warmup; ++w) {
+    status |= RunOnce(day, file.Lines(), results, false);
+  }
+
+  instrument::Reset(); // only report what the measured runs did
+  allocprof::Reset();
+  for (int r = 0; r < runs; ++r) {
+    status |= RunOnce(day, file.Lines(), results, true);
+  }
+
+  for (int i = 0; i < results.size(); ++i) {
+    results[i].allocations_per_run /= runs;
+    results[i].allocated_bytes_per_run /= runs;
+    results[i].status = status;
+    sort(results[i].run_ms.begin(), results[i].run_ms.end());
+  }
+  return results;
+}
+
+void WriteJSON(ostream& os, const vector<BenchResult>& results, const int runs, const int warmup) {
+  os << "{" << endl;
+  os << "  \"runs\": " << runs << "," << endl;
+  os << "  \"warmup\": " << warmup << "," << endl;
+  os << "  \"results\": [" << endl;
+  for (int i = 0; i < results.size(); ++i) {
+    const BenchResult& r = results[i];
+    os << "    {\"day\": \"" << r.day << "\", \"part\": \"" << r.part << "\""
+      << ", \"min_ms\": " << r.Percentile(0)
+      << ", \"median_ms\": " << r.Percentile(50)
+      << ", \"p99_ms\": " << r.Percentile(99)
+      << ", \"peak_rss_kb\": " << r.peak_rss_kb
+      << ", \"allocations\": " << r.allocations_per_run
+      << ", \"allocated_bytes\": " << r.allocated_bytes_per_run
+      << ", \"status\": " << r.status << "}"
+      << (i + 1 < results.size() ? "," : "") << endl;
+  }
+  os << "  ]" << endl;
+  os << "}" << endl;
+}
+
+int main(int argc, char** argv) {
+  int runs = 5;
+  int warmup = 1;
+  string json_file_name = "";
+  bool skip_slow = false;
+  string input_dir = "";
+  vector<string> selected_days;
+
+  for (int a = 1; a < argc; ++a) {
+    string arg = argv[a];
+    if (arg == "--runs" && a + 1 < argc) {
+      runs = atoi(argv[++a]);
+    }
+    else if (arg == "--warmup" && a + 1 < argc) {
+      warmup = atoi(argv[++a]);
+    }
+    else if (arg == "--json" && a + 1 < argc) {
+      json_file_name = argv[++a];
+    }
+    else if (arg == "--skip-slow") {
+      skip_slow = true;
+    }
+    else if (arg == "--input-dir" && a + 1 < argc) {
+      input_dir = argv[++a];
+    }
+    else if (arg.compare(0, 3, "day") == 0) {
+      selected_days.push_back(arg);
+    }
+    else {
+      cout << "Usage: " << argv[0] << " [--runs N] [--warmup N] [--json FILE] [--skip-slow] [--input-dir DIR] [dayNN ...]" << endl;
+      return -1;
+    }
+  }
+
+  if (runs <= 0 || warmup < 0) {
+    cout << "Number of runs must be positive, and warmup runs cannot be negative" << endl;
+    return -1;
+  }
+
+  cout << left << setw(7) << "day" << setw(7) << "part" << right
+    << setw(12) << "min ms" << setw(12) << "median ms" << setw(12) << "p99 ms"
+    << setw(14) << "peak RSS KB" << setw(14) << "allocs/run" << endl;
+
+  vector<BenchResult> results;
+  for (auto day:AllSolvers()) {
+    if (!selected_days.empty() && find(selected_days.begin(), selected_days.end(), day.name) == selected_days.end()) {
+      continue;
+    }
+    if (skip_slow && day.slow) {
+      continue;
+    }
+
+    string input_file = day.default_input_file;
+    if (input_dir != "" && ifstream(input_dir + "/" + day.name + ".txt").good()) {
+      input_file = input_dir + "/" + day.name + ".txt";
+    }
+
+    for (auto r:RunBenchmark(day, input_file, runs, warmup)) {
+      results.push_back(r);
+
+      cout << left << setw(7) << r.day << setw(7) << r.part << right << fixed << setprecision(3)
+        << setw(12) << r.Percentile(0) << setw(12) << r.Percentile(50) << setw(12) << r.Percentile(99)
+        << setw(14) << r.peak_rss_kb << setw(14) << r.allocations_per_run
+        << (r.status != 0 ? "  (solver reported failure)" : "") << endl;
+    }
+
+    if (instrument::Enabled()) {
+      cout << endl << "Instrumentation for " << day.name << " over " << runs << " runs:" << endl;
+      instrument::Report(cout);
+      cout << endl;
+    }
+    if (allocprof::Enabled()) {
+      cout << endl << "Allocation profile for " << day.name << " over " << runs << " runs:" << endl;
+      allocprof::Report(cout);
+      cout << endl;
+    }
+  }
+
+  if (json_file_name != "") {
+    ofstream json(json_file_name);
+    if (!json.is_open()) {
+      cout << "Failed to open JSON output file: " << json_file_name << endl;
+      return -1;
+    }
+    WriteJSON(json, results, runs, warmup);
+  }
+
+  for (auto r:results) {
+    if (r.status != 0) {
+      return -1;
+    }
+  }
+
+  return 0;
+}
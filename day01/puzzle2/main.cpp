@@ -2,87 +2,13 @@
 // Description: solver for Puzzle 2 of Day 1 of The Advent Of Code 2021
 // See: https://adventofcode.com/2021
 // Consider sums of a three-measurement sliding window. How many sums are larger than the previous sum?
+// Usage: day01_puzz2.out [input file], where the input file defaults to day01/input.txt
+// The solving is done by day01/solver.cpp, which is shared with Puzzle 1
 
-#include "../../util/fileutil.hpp" // ReadLinesFromFile
-#include <iostream>
-#include <string>
-#include <vector>
+#include "../solver.hpp" // Day01Solver
+#include "../../util/solver.hpp" // RunSolverMain
 
-using namespace std;
-
-const string kInputFileName = "day01/input.txt";
-const int kWindowSize = 3;
-
-// O(m*n) where n is the length of input, and m is kWindowSize
-// Since kWindowSize=3 is small, it is trivial to re-compute each sum it every time. 
-int BruteForce(const vector<int> input) {
-  if (input.size() <= kWindowSize) {
-    return 0;
-  }
-
-  int increases = 0;
-  for (int prev = 0, curr = 1; curr < input.size() - kWindowSize + 1; ++prev, ++curr) {
-    // Compute the sums of each window
-    int prev_sum = 0, curr_sum = 0;
-    // Compute the sum in the window using the constant variable rather than having to assume its value is 3 here
-    for (int i = prev; i < prev + kWindowSize; ++i) {
-      prev_sum += input[i];
-    }
-    for (int i = curr; i < curr + kWindowSize; ++i) {
-      curr_sum += input[i];
-    }
-    
-    // Evaluate if it increased
-    if (curr_sum > prev_sum) { 
-      ++increases;
-    }
-  }
-  return increases;
-}
-
-// O(n) where n is the length of input; m (where m is window_size) elements are looped through, doing constant work, and then n-m elements are looped through, doing constant work
-// If the window size became large, we should cache each sum to only compute it once, or have a sliding computation which subtracts the dropped window element and adds the new window element
-int SlidingSums(const vector<int> input, const int window_size) {
-  if (input.size() <= window_size) {
-    return 0;
-  }
-
-  int increases = 0;
-  int prev_sum = 0, curr_sum = 0;
-  // Compute first sum
-  for (int i = 0; i < window_size; ++i) {
-    prev_sum += input[i];
-  }
-
-  // Compute the new sum in a rolling fashion
-  for (int prev_idx = 0, incoming_win_idx = window_size; incoming_win_idx < input.size(); ++prev_idx, ++incoming_win_idx) {
-    curr_sum = prev_sum - input[prev_idx] + input[incoming_win_idx];
-    if (curr_sum > prev_sum) {
-      ++increases;
-    }
-
-    prev_sum = curr_sum;
-  }
-  return increases;
-}
-
-int main() {
-  // Read in file
-  pair<vector<string>, int> file_result = ReadLinesFromFile(kInputFileName);
-  if (file_result.second < 0) {
-    cout << "Unable to open file" << endl;
-    return -1;
-  }
-
-  vector<int> input;
-  for (vector<string>::const_iterator i = file_result.first.begin(); i != file_result.first.end(); ++i) {
-    int x = stoi(*i);
-    input.push_back(x);
-  }
-
-  // Process input
-  int answer = SlidingSums(input, kWindowSize);
-  cout << answer << endl;
-
-  return 0;
+int main(int argc, char** argv) {
+  day01::Day01Solver solver;
+  return RunSolverMain(solver, "day01/input.txt", argc, argv, 2);
 }
@@ -0,0 +1,45 @@
+// solver.cpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 1 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+
+#include "solver.hpp"
+#include <string>
+#include <stdexcept>
+
+using namespace std;
+
+namespace day01 {
+
+// Both parts compare each measurement with an earlier one:
+//   Part 1 compares it with the one just before it
+//   Part 2 compares sliding window sums, and consecutive windows share all but their oldest and newest measurements,
+//   so a window's sum is larger than the previous one's exactly when its newest measurement is larger than the previous window's oldest
+// So only the last kWindowSize measurements are kept, and each one is counted as it is read
+// O(1) per measurement, and O(kWindowSize) memory however long the input is
+
+void Day01Solver::ParseLine(const LineView& line) {
+  int measurement;
+  if (ScanSeparatedInts(line.begin(), line.end(), ',', &measurement, 1) != 1) {
+    throw invalid_argument("invalid depth measurement: " + line.ToString());
+  }
+
+  if (this->measurements_read >= 1 && measurement > this->recent[(this->measurements_read - 1) % kWindowSize]) { // "larger" == strictly increasing
+    ++this->increases;
+  }
+  if (this->measurements_read >= kWindowSize && measurement > this->recent[this->measurements_read % kWindowSize]) {
+    ++this->window_increases;
+  }
+
+  this->recent[this->measurements_read % kWindowSize] = measurement;
+  ++this->measurements_read;
+}
+
+int Day01Solver::SolvePart1() {
+  return this->increases;
+}
+
+int Day01Solver::SolvePart2() {
+  return this->window_increases;
+}
+
+} // namespace day01
@@ -0,0 +1,34 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Day 1 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: How many measurements are larger than the previous measurement?
+// Part 2: Consider sums of a three-measurement sliding window. How many sums are larger than the previous sum?
+
+#ifndef DAY01_SOLVER_HPP_
+#define DAY01_SOLVER_HPP_
+
+#include "../util/solver.hpp" // StreamingSolver
+
+namespace day01 {
+
+const int kWindowSize = 3;
+
+// Day01Solver counts the increases as it reads the measurements, so it can stream an input of any length
+class Day01Solver : public StreamingSolver<int, int> {
+  private:
+    int recent[kWindowSize]; // the last measurements read, indexed by their position in the input modulo kWindowSize
+    long long int measurements_read;
+    int increases;
+    int window_increases;
+
+  public:
+    Day01Solver(): measurements_read(0), increases(0), window_increases(0) {}
+
+    void ParseLine(const LineView& line);
+    int SolvePart1();
+    int SolvePart2();
+};
+
+} // namespace day01
+
+#endif // DAY01_SOLVER_HPP_
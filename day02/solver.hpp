@@ -0,0 +1,36 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Puzzle 1 and 2 of Day 2 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// What do you get if you multiply your final horizontal position by your final depth?
+// Part 1 and Part 2 treat the directions differently
+
+#ifndef DAY02_SOLVER_HPP_
+#define DAY02_SOLVER_HPP_
+
+#include "../util/solver.hpp" // StreamingSolver
+
+namespace day02 {
+
+// Day02Solver moves the submarine as it reads each step, so it can stream a course of any length
+class Day02Solver : public StreamingSolver<int, int> {
+  private:
+    // Part 1's position
+    int horizontal_position;
+    int depth_position;
+
+    // Part 2's position and aim
+    int aimed_horizontal_position;
+    int aimed_depth_position;
+    int aim;
+
+  public:
+    Day02Solver(): horizontal_position(0), depth_position(0), aimed_horizontal_position(0), aimed_depth_position(0), aim(0) {}
+
+    void ParseLine(const LineView& line);
+    int SolvePart1();
+    int SolvePart2();
+};
+
+} // namespace day02
+
+#endif // DAY02_SOLVER_HPP_
@@ -0,0 +1,161 @@
+// solver.cpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 3 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+
+#include "solver.hpp"
+#include <iostream>
+#include <bitset> // would use https://www.cplusplus.com/reference/vector/vector-bool/ if binary length was unknown
+#include <string>
+#include <vector>
+#include <queue>
+
+using namespace std;
+
+namespace day03 {
+
+// O(x*n) runtime where x is the number of bit positions in the data (in our case, 12), and n is the number of binary values
+unsigned long CalculatePowerConsumption(const vector<bitset<12>>& values) {
+  bitset<12> gamma_rate; // Each bit in the gamma rate can be determined by finding the most common bit in the corresponding position
+  bitset<12> epsilon_rate; // The epsilon rate is calculated in a similar way; rather than use the most common bit, the least common bit from each position is used
+  for (int i = 0; i < 12; ++i) {
+    int ones_count = 0;
+    int zeros_count = 0;
+
+    // Determine how many of each bit value is seen
+    // Are there any easy binary ops which can tell me the most common bit across an array of binary numbers? AND / OR / XOR / NOR - probably not, because binary operations take in two values, and if there was a whole pile of 0s vs one 0, it should interact with a single 1 the same... if we were to order them, maybe, but then we'd have to reorder them for every bit position
+    for (vector<bitset<12>>::const_iterator j = values.begin(); j != values.end(); ++j) {
+      bitset<12> value = *j;
+      if (value[i] == 1) {
+        ++ones_count;
+      }
+      else {
+        ++zeros_count;
+      }
+    }
+
+    gamma_rate[i] = 1 ? (ones_count > zeros_count) : 0; // if there are an equal number of 1s and 0s, 0 will be used (this is not specified in the puzzle rules, but has to be a choice somewhere)
+    epsilon_rate[i] = ~gamma_rate[i]; // since there are only 2 bit options, the most common bit is the opposite of the least common bit
+  }
+
+  return gamma_rate.to_ulong() * epsilon_rate.to_ulong();
+}
+
+// O(x*n) runtime where x is the number of bit positions in the data (in our case, 12), and n is the initial number of binary values (which never decreases in the worst case)
+// O(x*n) memory used, because the whole list is only stored in one place in each iteration, though it is duplicated in the intiial memory allocation
+bitset<12> CalculateOxGenRating(queue<bitset<12>> values) {
+  queue<bitset<12>>* initial_set = new queue<bitset<12>>(values); // use "new" rather than just taking the pointer of "values" so it is initialized on the heap
+  int bit_under_consideration = 11; // start with the "first" position out of 12
+  while (initial_set->size() > 1 && bit_under_consideration >= 0) {
+    // Determine how many of each bit value is seen
+    queue<bitset<12>>* ones_set = new queue<bitset<12>>;
+    queue<bitset<12>>* zeros_set = new queue<bitset<12>>;
+
+    int elems_left = initial_set->size();
+    for (int i = 0; i < elems_left; ++i) {
+      bitset<12> value = initial_set->front();
+      initial_set->pop();
+      if (value[bit_under_consideration] == 1) {
+        ones_set->push(value);
+      }
+      else {
+        zeros_set->push(value);
+      }
+    }
+
+    delete initial_set;
+    if (ones_set->size() >= zeros_set->size()) { // now specified: If 0 and 1 are equally common, keep values with a 1 in the position being considered
+      initial_set = ones_set;
+      delete zeros_set;
+    }
+    else {
+      initial_set = zeros_set;
+      delete ones_set;
+    }
+
+    --bit_under_consideration;
+  }
+
+  if (initial_set->size() != 1) {
+    cout << "error: algorithm resulted in non-terminal set of elements" << endl;
+  }
+
+  bitset<12> final_value = initial_set->front();
+  // not bothering to pop that last element, as we are cleaning up the memory immediately after checking the element
+  delete initial_set;
+
+  return final_value;
+}
+
+// O(x*n) runtime where x is the number of bit positions in the data (in our case, 12), and n is the initial number of binary values (which never decreases in the worst case)
+// O(x*n) memory used, because the whole list is only stored in one place in each iteration, though it is duplicated in the intiial memory allocation
+bitset<12> CalculateCO2ScrubberRating(queue<bitset<12>> values) {
+  queue<bitset<12>>* initial_set = new queue<bitset<12>>(values); // use "new" rather than just taking the pointer of "values" so it is initialized on the heap
+  int bit_under_consideration = 11; // start with the "first" position out of 12
+  while (initial_set->size() > 1 && bit_under_consideration >= 0) {
+    // Determine how many of each bit value is seen
+    queue<bitset<12>>* ones_set = new queue<bitset<12>>;
+    queue<bitset<12>>* zeros_set = new queue<bitset<12>>;
+
+    int elems_left = initial_set->size();
+    for (int i = 0; i < elems_left; ++i) {
+      bitset<12> value = initial_set->front();
+      initial_set->pop();
+      if (value[bit_under_consideration] == 1) {
+        ones_set->push(value);
+      }
+      else {
+        zeros_set->push(value);
+      }
+    }
+
+    delete initial_set;
+    // now specified: If 0 and 1 are equally common, keep values with a 0 in the position being considered
+    if (zeros_set->size() <= ones_set->size()) { // Consider: since the main difference between CalculateOxGenRating and CalculateCO2ScrubberRating is this evaluation block, pass a function into this function to be > or < to get rid of duplicate code
+      initial_set = zeros_set;
+      delete ones_set;
+    }
+    else {
+      initial_set = ones_set;
+      delete zeros_set;
+    }
+
+    --bit_under_consideration;
+  }
+
+  if (initial_set->size() != 1) {
+    cout << "error: algorithm resulted in non-terminal set of elements" << endl;
+  }
+
+  bitset<12> final_value = initial_set->front();
+  // not bothering to pop that last element, as we are cleaning up the memory immediately after checking the element
+  delete initial_set;
+
+  return final_value;
+}
+
+void Day03Solver::Parse(const vector<LineView>& lines) {
+  // parse lines from file as binary values
+  this->values.clear();
+  this->values.reserve(lines.size());
+  for (auto line:lines) {
+    bitset<12> binary_value(line.data(), line.size());
+    this->values.push_back(binary_value);
+  }
+}
+
+unsigned long Day03Solver::SolvePart1() {
+  return CalculatePowerConsumption(this->values);
+}
+
+unsigned long Day03Solver::SolvePart2() {
+  queue<bitset<12>> initial_set;
+  for (auto value:this->values) {
+    initial_set.push(value);
+  }
+
+  bitset<12> ox_gen_rating = CalculateOxGenRating(initial_set);
+  bitset<12> co2_scrubber_rating = CalculateCO2ScrubberRating(initial_set);
+  return ox_gen_rating.to_ulong() * co2_scrubber_rating.to_ulong();
+}
+
+} // namespace day03
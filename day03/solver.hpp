@@ -0,0 +1,28 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Day 3 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: What is the power consumption of the submarine?
+// Part 2: What is the life support rating of the submarine?
+
+#ifndef DAY03_SOLVER_HPP_
+#define DAY03_SOLVER_HPP_
+
+#include "../util/solver.hpp" // Solver
+#include <bitset>
+#include <vector>
+
+namespace day03 {
+
+class Day03Solver : public Solver<unsigned long, unsigned long> {
+  private:
+    std::vector<std::bitset<12>> values;
+
+  public:
+    void Parse(const std::vector<LineView>& lines);
+    unsigned long SolvePart1();
+    unsigned long SolvePart2();
+};
+
+} // namespace day03
+
+#endif // DAY03_SOLVER_HPP_
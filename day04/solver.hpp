@@ -0,0 +1,46 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 4 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: What will your final score be if you choose the first winning bingo board?
+// Part 2: Once the last board wins, what would its final score be?
+
+#ifndef DAY04_SOLVER_HPP_
+#define DAY04_SOLVER_HPP_
+
+#include "../util/solver.hpp" // Solver
+#include <vector>
+
+namespace day04 {
+
+class BingoBoard;
+
+class Day04Solver : public Solver<int, int> {
+  private:
+    std::vector<int> bingo_numbers;
+    std::vector<BingoBoard*> boards;
+    int first_win_final_score;
+    int last_win_final_score;
+    bool played;
+
+    void Play();
+
+    // the boards are owned by exactly one solver, so copying is not allowed
+    Day04Solver(const Day04Solver& other);
+    Day04Solver& operator=(const Day04Solver& other);
+
+  public:
+    Day04Solver(): first_win_final_score(-1), last_win_final_score(-1), played(false) {}
+
+    void Parse(const std::vector<LineView>& lines);
+    int SolvePart1();
+    int SolvePart2();
+
+    // both parts come from the same game, which marks the boards
+    bool Part2DependsOnPart1() const { return true; }
+
+    ~Day04Solver();
+};
+
+} // namespace day04
+
+#endif // DAY04_SOLVER_HPP_
@@ -0,0 +1,198 @@
+// solver.cpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 5 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: Consider only horizontal and vertical lines. At how many points do at least two lines overlap?
+// Part 2: Consider all of the lines (including the diagonal lines at 45 degrees). At how many points do at least two lines overlap?
+
+#include "solver.hpp"
+#include <iostream>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+#include <regex>
+#include <string>
+#include <cmath>
+
+using namespace std;
+
+namespace day05 {
+
+// O(1)
+bool IsHorizontal(pair<pair<int,int>, pair<int,int>> line_segment) {
+  if (line_segment.first.second == line_segment.second.second) { // same y values: horizontal
+    return true;
+  }
+
+  return false;
+}
+
+// O(1)
+bool IsVertical(pair<pair<int,int>, pair<int,int>> line_segment) {
+  if (line_segment.first.first == line_segment.second.first) { // same x values: vertical
+    return true;
+  }
+
+  return false;
+}
+
+void Day05Solver::Parse(const vector<LineView>& lines) {
+  // Determine size of map while parsing
+  // Parse file results into pairs of pairs of coordinates
+  regex r("(\\d+),(\\d+) -> (\\d+),(\\d+)");
+  for (vector<LineView>::const_iterator file_line = lines.begin(); file_line != lines.end(); ++file_line) {
+    const string line = file_line->ToString();
+    smatch m;
+    regex_search(line, m, r);
+    if (m.size() != 5) {
+      throw invalid_argument("unexpected format of line: '" + line + "'");
+    }
+
+    int x1 = stoi(m[1]), y1 = stoi(m[2]), x2 = stoi(m[3]), y2 = stoi(m[4]);
+    // Check if we need to adjust our map size
+    if (x1 > this->max_width) {
+      this->max_width = x1;
+    }
+    if (x2 > this->max_width) {
+      this->max_width = x2;
+    }
+    if (y1 > this->max_height) {
+      this->max_height = y1;
+    }
+    if (y2 > this->max_height) {
+      this->max_height = y2;
+    }
+
+    // Store the line segment
+    pair<pair<int,int>, pair<int,int>> line_segment(pair<int,int>(x1, y1), pair<int,int>(x2, y2));
+    this->line_segments.push_back(line_segment);
+  }
+
+  if (this->max_height == -1 || this->max_width == -1) {
+    throw invalid_argument("map size not determined");
+  }
+}
+
+int Day05Solver::SolvePart1() {
+  // Design
+  // option 1: keep track of the whole map, and what points are covered (vector of vector of ints representing number of lines covering the points) - this is constant-time access to fill in the map, so O(num_lines*max(map_width, map_height)) to fill all, but O(map_height*map_width) to finally check all the points - this could be optimized by keeping a counter while filling up the map, incrementing the counter when a map point goes from 1->2, O(1) -> O(num_lines*max(map_width, map_height))
+  // option 2: check each pair of line segments against each other; if all horizontals were ordered by their y position, perhaps using a priority queue, it would be fast to check if two horizontal lines overlapped at the same y, because you know two horizontals cannot overlap if they have different y values (similarly with verticals), all the while keeping a list of qualifying intersection points; then all horizontals would have to be checked against the verticals with relevant y values in their range, and vice versa...
+  // Given that I'm guessing Part 2 of the puzzle will be incorporating the diagonal line segments as well, or else plotting a path thru the map, I will go with Option 1
+
+  // Initialize map to be uncovered
+  this->covered_map.resize(this->max_width + 1);
+  for (int x = 0; x <= this->max_width; ++x) {
+    this->covered_map[x].resize(this->max_height + 1);
+    for (int y = 0; y <= this->max_height; ++y) {
+      this->covered_map[x][y] = 0;
+    }
+  }
+
+  // Cover the map with the horizontal and vertical line segments; Part 2 adds the diagonals on top
+  this->hor_vert_intersections = 0;
+  for (auto l:this->line_segments) {
+    if (IsHorizontal(l)) { // consistent y
+      int y = l.first.second;
+
+      // Line segments can have any direction; orient before marking to avoid confusion and bugs
+      int x_start, x_end;
+      if (l.first.first <= l.second.first) { // line segment can be a single point
+        x_start = l.first.first;
+        x_end = l.second.first;
+      }
+      else {
+        x_start = l.second.first;
+        x_end = l.first.first;
+      }
+
+      for (int x = x_start; x <= x_end; ++x) {
+        int curr = this->covered_map[x][y];
+        if (curr == 1) {
+          ++this->hor_vert_intersections;
+        }
+
+        this->covered_map[x][y] = curr + 1;
+      }
+    }
+    else if (IsVertical(l)) { // consistent x
+      int x = l.first.first;
+
+      // Line segments can have any direction; orient before marking to avoid confusion and bugs
+      int y_start, y_end;
+      if (l.first.second <= l.second.second) { // line segment can be a single point
+        y_start = l.first.second;
+        y_end = l.second.second;
+      }
+      else {
+        y_start = l.second.second;
+        y_end = l.first.second;
+      }
+
+      for (int y = y_start; y <= y_end; ++y) {
+        int curr = this->covered_map[x][y];
+        if (curr == 1) {
+          ++this->hor_vert_intersections;
+        }
+
+        this->covered_map[x][y] = curr + 1;
+      }
+    }
+  }
+
+  this->part1_done = true;
+  return this->hor_vert_intersections;
+}
+
+int Day05Solver::SolvePart2() {
+  if (!this->part1_done) {
+    this->SolvePart1();
+  }
+
+  // Part 2: now add in diagonal lines
+  int all_intersections = this->hor_vert_intersections;
+  for (auto l:this->line_segments) {
+    if (!IsHorizontal(l) && !IsVertical(l)) { // diagonal
+      // Check assumption that line is 45 degrees
+      if (abs(l.first.first - l.second.first) != abs(l.first.second - l.second.second)) {
+        throw invalid_argument("line is not diagonal: starting at " + to_string(l.first.first) + "," + to_string(l.first.second) + " and ending at " + to_string(l.second.first) + "," + to_string(l.second.second));
+      }
+
+      // Line segments can have any direction; orient with x values before marking to avoid confusion and bugs
+      int x_start, x_end, y_start, y_end;
+      if (l.first.first <= l.second.first) { // line segment can be a single point
+        x_start = l.first.first;
+        y_start = l.first.second;
+
+        x_end = l.second.first;
+        y_end = l.second.second;
+      }
+      else {
+        x_start = l.second.first;
+        y_start = l.second.second;
+
+        x_end = l.first.first;
+        y_end = l.first.second;
+      }
+
+      for (int x = x_start, y = y_start; x <= x_end; ++x) {
+        int curr = this->covered_map[x][y];
+        if (curr == 1) {
+          ++all_intersections;
+        }
+
+        this->covered_map[x][y] = curr + 1;
+
+        // Line segments can have any direction; check before moving y to next point (loop handles x)
+        if (y < y_end) {
+          ++y;
+        }
+        else {
+          --y;
+        }
+      }
+    }
+  }
+
+  return all_intersections;
+}
+
+} // namespace day05
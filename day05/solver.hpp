@@ -0,0 +1,36 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 5 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: Consider only horizontal and vertical lines. At how many points do at least two lines overlap?
+// Part 2: Consider all of the lines (including the diagonal lines at 45 degrees). At how many points do at least two lines overlap?
+
+#ifndef DAY05_SOLVER_HPP_
+#define DAY05_SOLVER_HPP_
+
+#include "../util/solver.hpp" // Solver
+#include <utility>
+#include <vector>
+
+namespace day05 {
+
+class Day05Solver : public Solver<int, int> {
+  private:
+    std::vector<std::pair<std::pair<int,int>, std::pair<int,int>>> line_segments;
+    int max_width;
+    int max_height;
+    std::vector<std::vector<int>> covered_map; // accessed by [x][y]; Part 2 adds the diagonals to Part 1's map
+    int hor_vert_intersections;
+    bool part1_done;
+
+  public:
+    Day05Solver(): max_width(-1), max_height(-1), hor_vert_intersections(0), part1_done(false) {}
+
+    void Parse(const std::vector<LineView>& lines);
+    int SolvePart1();
+    int SolvePart2();
+    bool Part2DependsOnPart1() const { return true; }
+};
+
+} // namespace day05
+
+#endif // DAY05_SOLVER_HPP_
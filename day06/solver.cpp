@@ -0,0 +1,89 @@
+// solver.cpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 6 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: How many lanternfish would there be after 80 days?
+// Part 2: How many lanternfish would there be after 256 days?
+
+#include "solver.hpp"
+#include "../util/fileutil.hpp" // ParseSeparatedInts
+#include <iostream>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+#include <string>
+#include <regex>
+
+using namespace std;
+
+namespace day06 {
+
+
+
+void Day06Solver::Parse(const vector<LineView>& lines) {
+  if (lines.empty()) {
+    throw invalid_argument("missing fish list");
+  }
+
+  pair<vector<int>,int> fish_results = ParseSeparatedInts(lines[0].ToString(), ",");
+  if (fish_results.second < 0) {
+    throw invalid_argument("unexpected file format");
+  }
+  this->fish = fish_results.first;
+}
+
+unsigned long long int Day06Solver::SolvePart1() {
+  for (int day = 1; day <= 80; ++day) {
+    int days_starting_fish_count = this->fish.size();
+    for (int f = 0; f < days_starting_fish_count; ++f) {
+      int until_repro = this->fish[f];
+      if (until_repro == 0) {
+        this->fish[f] = 6;
+        this->fish.push_back(8);
+      }
+      else {
+        this->fish[f] = until_repro - 1;
+      }
+    }
+  }
+
+  this->part1_done = true;
+  return this->fish.size();
+}
+
+unsigned long long int Day06Solver::SolvePart2() {
+  if (!this->part1_done) {
+    this->SolvePart1();
+  }
+
+  // Part 2: after 256 days, there would be too many to store and/or too slow to compute. Thus, the strategy will change to tracking the fish a different way; instead keep track of how many fish have a certain int value
+
+  // Initialize this tracking
+  vector<unsigned long long int> fish_with_age; // indexed by age
+  fish_with_age.resize(9);
+  for (int i = 0; i <= 8; ++i) {
+    fish_with_age[i] = 0;
+  }
+  for (auto f:this->fish) {
+    fish_with_age[f] += 1;
+  }
+
+  for (int day = 81; day <= 256; ++day) {
+    unsigned long long int fish_starting_at_0 = fish_with_age[0]; // save this value so it's not overwritten
+
+    for (int new_fish_age = 0; new_fish_age < 8; ++new_fish_age) {
+      fish_with_age[new_fish_age] = fish_with_age[new_fish_age + 1];
+    }
+
+    fish_with_age[6] += fish_starting_at_0; // renew fish who reach 0
+    fish_with_age[8] = fish_starting_at_0; // copy fish who reach 0
+  }
+
+  unsigned long long int total_fish = 0;
+  for (auto f:fish_with_age) {
+    total_fish += f;
+  }
+
+  return total_fish;
+}
+
+} // namespace day06
@@ -0,0 +1,31 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 6 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: How many lanternfish would there be after 80 days?
+// Part 2: How many lanternfish would there be after 256 days?
+
+#ifndef DAY06_SOLVER_HPP_
+#define DAY06_SOLVER_HPP_
+
+#include "../util/solver.hpp" // Solver
+#include <vector>
+
+namespace day06 {
+
+class Day06Solver : public Solver<unsigned long long int, unsigned long long int> {
+  private:
+    std::vector<int> fish; // days until each fish reproduces; Part 1 simulates on this list, and Part 2 carries on from there
+    bool part1_done;
+
+  public:
+    Day06Solver(): part1_done(false) {}
+
+    void Parse(const std::vector<LineView>& lines);
+    unsigned long long int SolvePart1();
+    unsigned long long int SolvePart2();
+    bool Part2DependsOnPart1() const { return true; }
+};
+
+} // namespace day06
+
+#endif // DAY06_SOLVER_HPP_
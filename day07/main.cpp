@@ -3,90 +3,13 @@
 // See: https://adventofcode.com/2021
 // Part 1: The crab movement cost is constant; How much fuel must they spend to align to that position?
 // Part 2: The crab movement cost increases linearly; How much fuel must they spend to align to that position?
+// Usage: day07.out [input file], where the input file defaults to day07/input.txt
+// The solving is done by day07/solver.cpp, so it can also be run in-process (see util/solver.hpp)
 
-#include "../util/fileutil.hpp" // ReadLinesFromFile, ParseSeparatedInts
-#include <iostream>
-#include <tuple>
-#include <vector>
-#include <string>
-#include <cmath>
-#include <algorithm>
+#include "solver.hpp" // Day07Solver
+#include "../util/solver.hpp" // RunSolverMain
 
-using namespace std;
-
-int main() {
-  pair<vector<string>, int> file_results = ReadLinesFromFile("day07/input.txt");
-  if (file_results.second < 0) {
-    cout << "Failed to read file" << endl;
-    return -1;
-  }
-
-  // Parse file input
-  if (file_results.first.size() != 1) {
-    cout << "Unexpected file length" << endl;
-    return -1;
-  }
-
-  pair<vector<int>, int> crab_results = ParseSeparatedInts(file_results.first[0], ",");
-  if (crab_results.second < 0) {
-    cout << "Unexpected file format" << endl;
-    return -1;
-  }
-
-  double crab_sum = 0;
-  for (auto crab:crab_results.first) {
-    crab_sum += 1.0 * crab;
-  }
-  double crab_avg = crab_sum / (1.0 * crab_results.first.size());
-  double low_crab_avg = floor(crab_avg);
-  double high_crab_avg = ceil(crab_avg);
-  cout << "Average " << crab_avg << " floored and ceilinged: " << low_crab_avg << " " << high_crab_avg << endl;
-
-
-  // Part 1:
-  // Could take brute-force and check each of these options and keep track of the minimum fuel cost found
-  // The answer is the median of the data, which is the "mid-point" that's easiest overall to move to
-  sort(crab_results.first.begin(), crab_results.first.end()); // O(n * log(n))
-
-  int low_med = crab_results.first[crab_results.first.size() / 2], high_med = crab_results.first[crab_results.first.size() / 2 + 1];
-  cout << "Median: " << low_med << " and the next highest possiblity: " << high_med << endl;
-
-  // Options for aligning the crabs are in the range of min(crab_positions) and max(crab_positions)
-  cout << "Range of crabs: " << crab_results.first[0] << " to " << crab_results.first[crab_results.first.size() - 1] << endl;
-
-  // Calculate the fuel cost around the median values
-  double min_fuel_cost = -1;
-  int min_fuel_cost_point = -1;
-  for (int i = low_med; i < high_med; ++i) {
-    // Calculate fuel cost at this chosen point
-    double fuel_cost = 0;
-    for (auto crab:crab_results.first) {
-      fuel_cost += abs(1.0 * i - crab);
-    }
-
-    if (min_fuel_cost == -1 || fuel_cost < min_fuel_cost) {
-      min_fuel_cost = fuel_cost;
-      min_fuel_cost_point = i;
-    }
-  }
-
-  cout << "Part 1 answer: " << min_fuel_cost << " at point " << min_fuel_cost_point << endl;
-
-  // Part 2:
-  // Crab movement cost is 1 to move 1 space to the chosen point, 2 to move the next space, etc.
-  // The answer point works out to be the average because it's a weighted mid-point
-  // Try both low and high average values to see which one would have the lower fuel cost
-  unsigned long long int fuel_cost_from_low_avg = 0, fuel_cost_from_high_avg = 0;
-  for (auto crab:crab_results.first) {
-    double spaces_to_move = abs(low_crab_avg - 1.0 * crab);
-    fuel_cost_from_low_avg += spaces_to_move * (spaces_to_move + 1) / 2; // sum of natural numbers up to spaces_to_move
-
-    spaces_to_move = abs(high_crab_avg - 1.0 * crab);
-    fuel_cost_from_high_avg += spaces_to_move * (spaces_to_move + 1) / 2; // sum of natural numbers up to spaces_to_move
-  }
-
-  cout << "Fuel cost from average floored and ceilinged: " << fuel_cost_from_low_avg << " " << fuel_cost_from_high_avg << endl;
-  cout << "Part 2 answer: " << (fuel_cost_from_low_avg < fuel_cost_from_high_avg ? fuel_cost_from_low_avg : fuel_cost_from_high_avg) << endl;
-
-  return 0;
+int main(int argc, char** argv) {
+  day07::Day07Solver solver;
+  return RunSolverMain(solver, "day07/input.txt", argc, argv);
 }
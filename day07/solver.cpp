@@ -0,0 +1,87 @@
+// solver.cpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 7 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: The crab movement cost is constant; How much fuel must they spend to align to that position?
+// Part 2: The crab movement cost increases linearly; How much fuel must they spend to align to that position?
+
+#include "solver.hpp"
+#include "../util/fileutil.hpp" // ParseSeparatedInts
+#include <iostream>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+
+using namespace std;
+
+namespace day07 {
+
+
+
+void Day07Solver::Parse(const vector<LineView>& lines) {
+  if (lines.size() != 1) {
+    throw invalid_argument("unexpected file length");
+  }
+
+  pair<vector<int>, int> crab_results = ParseSeparatedInts(lines[0].ToString(), ",");
+  if (crab_results.second < 0 || crab_results.first.size() < 2) {
+    throw invalid_argument("unexpected file format");
+  }
+
+  // Part 1 needs the positions in order, and Part 2 does not care about their order, so sort once here
+  this->crab_positions = crab_results.first;
+  sort(this->crab_positions.begin(), this->crab_positions.end()); // O(n * log(n))
+}
+
+// Part 1:
+// Could take brute-force and check each of these options and keep track of the minimum fuel cost found
+// The answer is the median of the data, which is the "mid-point" that's easiest overall to move to
+long long int Day07Solver::SolvePart1() {
+  const vector<int>& crabs = this->crab_positions;
+  int low_med = crabs[crabs.size() / 2], high_med = crabs[crabs.size() / 2 + 1];
+
+  // Calculate the fuel cost around the median values
+  double min_fuel_cost = -1;
+  for (int i = low_med; i <= high_med; ++i) { // the two may be equal when many crabs share the median position
+    // Calculate fuel cost at this chosen point
+    double fuel_cost = 0;
+    for (auto crab:crabs) {
+      fuel_cost += abs(1.0 * i - crab);
+    }
+
+    if (min_fuel_cost == -1 || fuel_cost < min_fuel_cost) {
+      min_fuel_cost = fuel_cost;
+    }
+  }
+
+  return (long long int)min_fuel_cost;
+}
+
+// Part 2:
+// Crab movement cost is 1 to move 1 space to the chosen point, 2 to move the next space, etc.
+// The answer point works out to be the average because it's a weighted mid-point
+// Try both low and high average values to see which one would have the lower fuel cost
+unsigned long long int Day07Solver::SolvePart2() {
+  double crab_sum = 0;
+  for (auto crab:this->crab_positions) {
+    crab_sum += 1.0 * crab;
+  }
+  double crab_avg = crab_sum / (1.0 * this->crab_positions.size());
+  double low_crab_avg = floor(crab_avg);
+  double high_crab_avg = ceil(crab_avg);
+
+  unsigned long long int fuel_cost_from_low_avg = 0, fuel_cost_from_high_avg = 0;
+  for (auto crab:this->crab_positions) {
+    double spaces_to_move = abs(low_crab_avg - 1.0 * crab);
+    fuel_cost_from_low_avg += spaces_to_move * (spaces_to_move + 1) / 2; // sum of natural numbers up to spaces_to_move
+
+    spaces_to_move = abs(high_crab_avg - 1.0 * crab);
+    fuel_cost_from_high_avg += spaces_to_move * (spaces_to_move + 1) / 2; // sum of natural numbers up to spaces_to_move
+  }
+
+  return fuel_cost_from_low_avg < fuel_cost_from_high_avg ? fuel_cost_from_low_avg : fuel_cost_from_high_avg;
+}
+
+} // namespace day07
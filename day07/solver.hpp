@@ -0,0 +1,27 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 7 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: The crab movement cost is constant; How much fuel must they spend to align to that position?
+// Part 2: The crab movement cost increases linearly; How much fuel must they spend to align to that position?
+
+#ifndef DAY07_SOLVER_HPP_
+#define DAY07_SOLVER_HPP_
+
+#include "../util/solver.hpp" // Solver
+#include <vector>
+
+namespace day07 {
+
+class Day07Solver : public Solver<long long int, unsigned long long int> {
+  private:
+    std::vector<int> crab_positions; // sorted
+
+  public:
+    void Parse(const std::vector<LineView>& lines);
+    long long int SolvePart1();
+    unsigned long long int SolvePart2();
+};
+
+} // namespace day07
+
+#endif // DAY07_SOLVER_HPP_
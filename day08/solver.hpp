@@ -0,0 +1,40 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 8 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: In the output values, how many times do digits 1, 4, 7, or 8 appear?
+// Part 2: What do you get if you add up all of the output values?
+
+#ifndef DAY08_SOLVER_HPP_
+#define DAY08_SOLVER_HPP_
+
+#include "../util/solver.hpp" // Solver
+#include <vector>
+
+namespace day08 {
+
+class PuzzleInput;
+
+class Day08Solver : public Solver<int, unsigned long long int> {
+  private:
+    PuzzleInput* input;
+
+    // the parsed input is owned by exactly one solver, so copying is not allowed
+    Day08Solver(const Day08Solver& other);
+    Day08Solver& operator=(const Day08Solver& other);
+
+  public:
+    Day08Solver(): input(NULL) {}
+
+    void Parse(const std::vector<LineView>& lines);
+    int SolvePart1();
+    unsigned long long int SolvePart2();
+
+    // decoding a digit caches what each signal pattern represents, so the parts share state
+    bool Part2DependsOnPart1() const { return true; }
+
+    ~Day08Solver();
+};
+
+} // namespace day08
+
+#endif // DAY08_SOLVER_HPP_
@@ -0,0 +1,35 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 9 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: What is the sum of the risk levels of all low points on your heightmap?
+// Part 2: What do you get if you multiply together the sizes of the three largest basins?
+
+#ifndef DAY09_SOLVER_HPP_
+#define DAY09_SOLVER_HPP_
+
+#include "../util/solver.hpp" // Solver
+#include <utility>
+#include <vector>
+
+namespace day09 {
+
+class Day09Solver : public Solver<int, int> {
+  private:
+    std::vector<std::vector<std::pair<int,bool>>> height_map; // accessed by [row][col]; pair represents height and whether it's been explored
+    std::vector<std::pair<int,int>> low_points; // found by Part 1
+    bool part1_done;
+
+  public:
+    Day09Solver(): part1_done(false) {}
+
+    void Parse(const std::vector<LineView>& lines);
+    int SolvePart1();
+    int SolvePart2();
+
+    // Part 2 explores the basins around Part 1's low points, marking the map as it goes
+    bool Part2DependsOnPart1() const { return true; }
+};
+
+} // namespace day09
+
+#endif // DAY09_SOLVER_HPP_
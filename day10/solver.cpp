@@ -0,0 +1,163 @@
+// solver.cpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 10 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: Find the first illegal character in each corrupted line of the navigation subsystem. What is the total syntax error score for those errors?
+// Part 2: Find the completion string for each incomplete line, score the completion strings, and sort the scores. What is the middle score?
+
+#include "solver.hpp"
+#include <iostream>
+#include <tuple>
+#include <vector>
+#include <string>
+#include <stack>
+#include <map>
+#include <stdexcept>
+#include <algorithm>
+
+using namespace std;
+
+namespace day10 {
+
+class ChunkRelations {
+  private:
+    map<char,char> open_close;
+    map<char,int> closing_syntax_error_scores;
+    map<char,int> closing_autocomplete_scores;
+  public:
+    ChunkRelations();
+    bool IsCharacterOpening(const char& c);
+    bool IsCharacterClosing(const char& c);
+    const char& ClosingCharacterFor(const char& c);
+    int SyntaxErrorScore(const char& c);
+    unsigned long long int AutocompleteScore(const string& s);
+};
+
+ChunkRelations::ChunkRelations() {
+  this->open_close['('] = ')';
+  this->open_close['['] = ']';
+  this->open_close['{'] = '}';
+  this->open_close['<'] = '>';
+
+  this->closing_syntax_error_scores[')'] = 3;
+  this->closing_syntax_error_scores[']'] = 57;
+  this->closing_syntax_error_scores['}'] = 1197;
+  this->closing_syntax_error_scores['>'] = 25137;
+
+  this->closing_autocomplete_scores[')'] = 1;
+  this->closing_autocomplete_scores[']'] = 2;
+  this->closing_autocomplete_scores['}'] = 3;
+  this->closing_autocomplete_scores['>'] = 4;
+}
+
+bool ChunkRelations::IsCharacterOpening(const char& c) {
+  return (this->open_close.find(c) != this->open_close.end());
+}
+
+bool ChunkRelations::IsCharacterClosing(const char& c) {
+  return (this->closing_syntax_error_scores.find(c) != this->closing_syntax_error_scores.end());
+}
+
+const char& ChunkRelations::ClosingCharacterFor(const char& c) {
+  auto r = this->open_close.find(c);
+  if (r == this->open_close.end()) {
+    throw invalid_argument("Not an opening character");
+  }
+  return r->second;
+}
+
+int ChunkRelations::SyntaxErrorScore(const char& c) {
+  auto r = this->closing_syntax_error_scores.find(c);
+  if (r == this->closing_syntax_error_scores.end()) {
+    throw invalid_argument("Not a closing character");
+  }
+  return r->second;
+}
+
+unsigned long long int ChunkRelations::AutocompleteScore(const string& s) {
+  unsigned long long int score = 0;
+
+  for (int i = 0; i < s.size(); ++i) {
+    int char_score = this->closing_autocomplete_scores[s[i]];
+    score = score * 5 + char_score;
+  }
+
+  return score;
+}
+
+// ScoreLine checks the chunks in a line of the navigation subsystem, returning two values:
+//   The first return value is true if the line is corrupted, and false if it is only incomplete
+//   The second return value is the syntax error score of a corrupted line, or the autocomplete score of an incomplete line
+// Runtime complexity: linear in the length of the line
+pair<bool, unsigned long long int> ScoreLine(const string& line, ChunkRelations& r) {
+  stack<int> s;
+  for (int i = 0; i < line.size(); ++i) {
+    // If a character is opening, then it is the start of a new chunk: stack it
+    if (r.IsCharacterOpening(line[i])) {
+      s.push(line[i]);
+      continue;
+    }
+
+    // ... else it must be closing
+    // If it closes the last-seen opening character, it is valid
+    if (r.ClosingCharacterFor(s.top()) == line[i]) {
+      s.pop();
+      continue;
+    }
+    
+    // If it is invalid, but still a closing character, than this is a corrupted line
+    // Stop at the first incorrect closing character on each corrupted line to determine the syntax error score for the line
+    return pair<bool, unsigned long long int>(true, r.SyntaxErrorScore(line[i]));
+  }
+
+  // All non-corrupted lines are incomplete
+  // Using the stack, determine the appropriate closing characters needed and determine its score
+  string missing_closing_chars = "";
+  while (!s.empty()) {
+    missing_closing_chars.append(1, r.ClosingCharacterFor(s.top()));
+    s.pop();
+  }
+  return pair<bool, unsigned long long int>(false, r.AutocompleteScore(missing_closing_chars));
+}
+
+Day10Solver::Day10Solver(): sum_corrupted_score(0) {
+  this->relations = new ChunkRelations();
+}
+
+Day10Solver::~Day10Solver() {
+  delete this->relations;
+}
+
+// Each line is scored as it is read, so only one score per incomplete line is kept rather than the lines themselves
+// The middle score needs all of them, since the median cannot be found in a single pass with less
+void Day10Solver::ParseLine(const LineView& line) {
+  pair<bool, unsigned long long int> line_score = ScoreLine(line.ToString(), *this->relations);
+  if (line_score.first) {
+    this->sum_corrupted_score += line_score.second;
+  }
+  else {
+    this->autocomplete_scores.push_back(line_score.second);
+  }
+}
+
+// Part 1:
+// Sum the syntax error scores of all corrupted lines
+unsigned long long int Day10Solver::SolvePart1() {
+  return this->sum_corrupted_score;
+}
+
+// Part 2:
+// Find the middle autocomplete score of the incomplete lines
+// Runtime complexity: linear in the number of incomplete lines, since only the middle score needs to be in place
+unsigned long long int Day10Solver::SolvePart2() {
+  if (this->autocomplete_scores.empty()) {
+    throw logic_error("no incomplete lines");
+  }
+
+  vector<unsigned long long int>::iterator middle = this->autocomplete_scores.begin() + this->autocomplete_scores.size() / 2;
+  nth_element(this->autocomplete_scores.begin(), middle, this->autocomplete_scores.end());
+  return *middle;
+}
+
+} // namespace day10
+
+// TODO ideas for future days: add compiler warnings/errors (-Wall, -Werror, etc.)
@@ -0,0 +1,40 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 10 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: Find the first illegal character in each corrupted line of the navigation subsystem. What is the total syntax error score for those errors?
+// Part 2: Find the completion string for each incomplete line, score the completion strings, and sort the scores. What is the middle score?
+
+#ifndef DAY10_SOLVER_HPP_
+#define DAY10_SOLVER_HPP_
+
+#include "../util/solver.hpp" // StreamingSolver
+#include <vector>
+
+namespace day10 {
+
+class ChunkRelations;
+
+// Day10Solver scores each line of the navigation subsystem as it is read, so it can stream the subsystem
+class Day10Solver : public StreamingSolver<unsigned long long int, unsigned long long int> {
+  private:
+    ChunkRelations* relations;
+    unsigned long long int sum_corrupted_score;
+    std::vector<unsigned long long int> autocomplete_scores;
+
+    // the relations are owned by exactly one solver, so copying is not allowed
+    Day10Solver(const Day10Solver& other);
+    Day10Solver& operator=(const Day10Solver& other);
+
+  public:
+    Day10Solver();
+
+    void ParseLine(const LineView& line);
+    unsigned long long int SolvePart1();
+    unsigned long long int SolvePart2();
+
+    ~Day10Solver();
+};
+
+} // namespace day10
+
+#endif // DAY10_SOLVER_HPP_
@@ -0,0 +1,32 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 11 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: Given the starting energy levels of the dumbo octopuses in your cavern, simulate 100 steps. How many total flashes are there after 100 steps?
+// Part 2: What is the first step during which all octopuses flash?
+
+#ifndef DAY11_SOLVER_HPP_
+#define DAY11_SOLVER_HPP_
+
+#include "../util/solver.hpp" // Solver
+#include <vector>
+
+namespace day11 {
+
+class Day11Solver : public Solver<unsigned long long int, int> {
+  private:
+    std::vector<std::vector<int>> octopus_energies; // accessed by [row][col]; Part 1 steps these, and Part 2 carries on from there
+    int first_all_flash_step; // -1 until seen
+    int steps_done;
+
+  public:
+    Day11Solver(): first_all_flash_step(-1), steps_done(0) {}
+
+    void Parse(const std::vector<LineView>& lines);
+    unsigned long long int SolvePart1();
+    int SolvePart2();
+    bool Part2DependsOnPart1() const { return true; }
+};
+
+} // namespace day11
+
+#endif // DAY11_SOLVER_HPP_
@@ -0,0 +1,43 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 12 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: don't visit small caves more than once; how many paths through this cave system are there that visit small caves at most once?
+// Part 2: a single small cave can be visited at most twice, and the remaining small caves can be visited at most once; how many paths through this cave system are there?
+
+#ifndef DAY12_SOLVER_HPP_
+#define DAY12_SOLVER_HPP_
+
+#include "../util/solver.hpp" // Solver
+#include <map>
+#include <string>
+#include <vector>
+
+namespace day12 {
+
+class Cave;
+
+class Day12Solver : public Solver<int, int> {
+  private:
+    // for initialization/cleanup ease, keep a reference to all caves
+    std::map<std::string,Cave*> all_caves;
+
+    // the caves are owned by exactly one solver, so copying is not allowed
+    Day12Solver(const Day12Solver& other);
+    Day12Solver& operator=(const Day12Solver& other);
+
+  public:
+    Day12Solver() {}
+
+    void Parse(const std::vector<LineView>& lines);
+    int SolvePart1();
+    int SolvePart2();
+
+    // both parts mark caves as discovered while searching, so they cannot search at the same time
+    bool Part2DependsOnPart1() const { return true; }
+
+    ~Day12Solver();
+};
+
+} // namespace day12
+
+#endif // DAY12_SOLVER_HPP_
@@ -0,0 +1,202 @@
+// solver.cpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 13 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: How many dots are visible after completing just the first fold instruction on your transparent paper?
+// Part 2: What code do you use to activate the infrared thermal imaging camera system? (8 capital letters)
+
+#include "solver.hpp"
+#include "../util/fileutil.hpp" // ScanSeparatedInts
+#include <iostream>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+#include <string>
+#include <regex>
+
+using namespace std;
+
+namespace day13 {
+
+// FoldPaper returns the dot map after the given paper state is folded over itself according to the given instruction
+// x folds to the left; y folds up
+// Note: the input looks like it folds in half every time, but if the fold instruction is not in the middle of initial_paper, will treat the overhang as part of the next paper stage
+vector<vector<bool>> FoldPaper(const vector<vector<bool>>& initial_paper, const pair<string,int>& fold_instruction) {
+  // Initialize the folded paper
+  vector<vector<bool>> folded_paper;
+  if (fold_instruction.first == "x") {
+    folded_paper.resize(fold_instruction.second > initial_paper.size() - fold_instruction.second - 1 ? fold_instruction.second : initial_paper.size() - fold_instruction.second - 1);
+  }
+  else {
+    folded_paper.resize(initial_paper.size());
+  }
+  for (int x = 0; x < folded_paper.size(); ++x) {
+    if (fold_instruction.first == "y") {
+      folded_paper[x].resize(fold_instruction.second > initial_paper[x].size() - fold_instruction.second - 1 ? fold_instruction.second : initial_paper[x].size() - fold_instruction.second - 1);
+    }
+    else {
+      folded_paper[x].resize(initial_paper[x].size());
+    }
+
+    for (int y = 0; y < folded_paper[x].size(); ++y) {
+      folded_paper[x][y] = false;
+    }
+  }
+
+  // Fill in the folded paper by combining the initial values
+  if (fold_instruction.first == "x") {
+    for (int i = 1; i <= folded_paper.size(); ++i) {
+      for (int y = 0; y < folded_paper[0].size(); ++y) {
+        // check if a dot was present to the left of the fold
+        if ((fold_instruction.second - i) >= 0) {
+          if (initial_paper[fold_instruction.second - i][y]) {
+            folded_paper[fold_instruction.second - i][y] = true;
+            continue;
+          }
+        }
+        else {
+          cout << "Unexpected unequal fold instruction" << endl;
+          return folded_paper;
+        }
+        // check if a dot was present to the right of the fold
+        if ((fold_instruction.second + i) < initial_paper.size()) {
+          if (initial_paper[fold_instruction.second + i][y]) {
+            folded_paper[fold_instruction.second - i][y] = true;
+            continue;
+          }
+        }
+        else {
+          cout << "Unexpected unequal fold instruction" << endl;
+          return folded_paper;
+        }
+      }
+    }
+  }
+  else if (fold_instruction.first == "y") {
+    for (int x = 0; x < folded_paper.size(); ++x) {
+      for (int i = 1; i <= folded_paper[x].size(); ++i) {
+        // check if a dot was present above the fold
+        if ((fold_instruction.second - i) >= 0) {
+          if (initial_paper[x][fold_instruction.second - i]) {
+            folded_paper[x][fold_instruction.second - i] = true;
+            continue;
+          }
+        }
+        else {
+          cout << "Unexpected unequal fold instruction" << endl;
+          return folded_paper;
+        }
+        // check if a dot was present below the fold
+        if ((fold_instruction.second + i) < initial_paper[x].size()) {
+          if (initial_paper[x][fold_instruction.second + i]) {
+            folded_paper[x][fold_instruction.second - i] = true;
+            continue;
+          }
+        }
+        else {
+          cout << "Unexpected unequal fold instruction" << endl;
+          return folded_paper;
+        }
+      }
+    }
+  }
+  else {
+    cout << "Unexpected fold instruction dimension: " << fold_instruction.first << endl;
+    return folded_paper;
+  }
+
+  return folded_paper;
+}
+
+void Day13Solver::Parse(const vector<LineView>& lines) {
+  vector<pair<int,int>> dot_coordinates; // in pairs (x,y)
+  int max_x = -1, max_y = -1;
+  regex fold_rgx("fold along ([xy])=(\\d+)");
+  bool fold_instructions_begin = false;
+  
+  // Parse file input
+  for (auto line:lines) {
+    if (line.empty()) {
+      fold_instructions_begin = true;
+      continue;
+    }
+
+    // parse dot coordinates using the comma-separated int helper function
+    if (!fold_instructions_begin) {
+      int coordinate[2];
+      if (ScanSeparatedInts(line.data(), line.data() + line.size(), ',', coordinate, 2) != 2) {
+        throw invalid_argument("unexpected format of dot coordinate: " + line.ToString());
+      }
+
+      int x = coordinate[0], y = coordinate[1];
+      if (x > max_x) {
+        max_x = x;
+      }
+      if (y > max_y) {
+        max_y = y;
+      }
+
+      dot_coordinates.push_back(pair<int,int>(x, y));
+    }
+    // parse fold instructions
+    else {
+      const string instruction = line.ToString();
+      smatch m;
+      regex_search(instruction, m, fold_rgx);
+      if (m.size() != 3) {
+        throw invalid_argument("unexpected format of fold instruction: " + instruction);
+      }
+
+      this->fold_instructions.push_back(pair<string,int>(m[1], stoi(m[2])));
+    }
+  }
+
+  // Initialize starting state of paper
+  this->paper.resize(max_x+1);
+  for (int x = 0; x <= max_x; ++x) {
+    this->paper[x].resize(max_y+1);
+    for (int y = 0; y <= max_y; ++y) {
+      this->paper[x][y] = false;
+    }
+  }
+  for (auto c:dot_coordinates) {
+    this->paper[c.first][c.second] = true;
+  }
+
+  if (this->fold_instructions.empty()) {
+    throw invalid_argument("no fold instructions");
+  }
+}
+
+int Day13Solver::SolvePart1() {
+  vector<vector<bool>> new_paper = FoldPaper(this->paper, this->fold_instructions[0]);
+
+  int dot_count = 0;
+  for (int x = 0; x < new_paper.size(); ++x) {
+    for (int y = 0; y < new_paper[x].size(); ++y) {
+      if (new_paper[x][y]) { ++dot_count; }
+    }
+  }
+  return dot_count;
+}
+
+string Day13Solver::SolvePart2() {
+  vector<vector<bool>> new_paper = this->paper;
+  for (int f = 0; f < this->fold_instructions.size(); ++f) {
+    new_paper = FoldPaper(new_paper, this->fold_instructions[f]);
+  }
+
+  // Draw the final paper so it's easier to read
+  // Turns out Letters are easiest to read iterating over y then x - TODO this is because I was conceiving of the axes as switched: correct all spots where coordinates are referenced
+  string drawing = "";
+  for (int y = 0; y < new_paper[0].size(); ++y) {
+    if (y > 0) {
+      drawing.append(1, '\n');
+    }
+    for (int x = 0; x < new_paper.size(); ++x) {
+      drawing.append(1, new_paper[x][y] ? '#' : ' ');
+    }
+  }
+  return drawing;
+}
+
+} // namespace day13
@@ -0,0 +1,30 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 13 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: How many dots are visible after completing just the first fold instruction on your transparent paper?
+// Part 2: What code do you use to activate the infrared thermal imaging camera system? (8 capital letters)
+
+#ifndef DAY13_SOLVER_HPP_
+#define DAY13_SOLVER_HPP_
+
+#include "../util/solver.hpp" // Solver
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace day13 {
+
+class Day13Solver : public Solver<int, std::string> {
+  private:
+    std::vector<std::vector<bool>> paper; // accessed using [x][y] ; increasing x represents values moving to the right on the paper; increasing y represents values moving down the paper
+    std::vector<std::pair<std::string,int>> fold_instructions;
+
+  public:
+    void Parse(const std::vector<LineView>& lines);
+    int SolvePart1();
+    std::string SolvePart2(); // the letters drawn by the dots, one line of text per row of the paper
+};
+
+} // namespace day13
+
+#endif // DAY13_SOLVER_HPP_
@@ -0,0 +1,34 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 14 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: After 10 steps: what do you get if you take the quantity of the most common element and subtract the quantity of the least common element?
+// Part 2: After 40 steps: what do you get if you take the quantity of the most common element and subtract the quantity of the least common element?
+
+#ifndef DAY14_SOLVER_HPP_
+#define DAY14_SOLVER_HPP_
+
+#include "../util/solver.hpp" // Solver
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace day14 {
+
+class Day14Solver : public Solver<unsigned long long int, unsigned long long int> {
+  private:
+    std::string polymer; // Part 1 applies its steps to this, and Part 2 carries on from there
+    std::vector<std::pair<std::string,std::string>> pair_insertion_rules;
+    bool part1_done;
+
+  public:
+    Day14Solver(): part1_done(false) {}
+
+    void Parse(const std::vector<LineView>& lines);
+    unsigned long long int SolvePart1();
+    unsigned long long int SolvePart2();
+    bool Part2DependsOnPart1() const { return true; }
+};
+
+} // namespace day14
+
+#endif // DAY14_SOLVER_HPP_
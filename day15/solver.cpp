@@ -0,0 +1,542 @@
+// solver.cpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 15 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: What is the lowest total risk of any path from the top left to the bottom right?
+// Part 2: Using the full map, what is the lowest total risk of any path from the top left to the bottom right?
+
+#include "solver.hpp"
+#include "../util/instrument.hpp" // AOC_TIME_SCOPE, AOC_COUNT, AOC_HISTOGRAM
+#include "../util/indexedheap.hpp" // IndexedHeap
+#include "../util/bucketqueue.hpp" // BucketQueue
+#include "../util/threadpool.hpp" // ThreadPool
+#include <iostream>
+#include <tuple>
+#include <vector>
+#include <string>
+#include <stdexcept>
+#include <cmath>
+#include <queue>
+#include <map>
+#include <limits>
+#include <algorithm>
+#include <atomic>
+
+using namespace std;
+
+namespace day15 {
+
+// Use this type declaration to facilitate use of pair type for coordinates
+typedef pair<int,int> node;
+
+typedef int (*heuristic_func)(const node& point, const node& end);
+
+// AStarHeuristic estimates the cost of reaching the given end coordinate from the given point
+// Since diagonal moves are not possible, the estimated cost is moving directly across rows and directly across columns, since a move costs at least 1
+// The end point is expected to be at the max row and max col values, but do not assume (it costs just as much to move left as right)
+int AStarHeuristic(const node& point, const node& end) {
+  return abs(0.0 + end.first - point.first) + abs(0.0 + end.second - point.second);
+}
+
+// FScoreCoordinate is used to represent nodes for the A* algorithm, so they can be sorted in a priority queue by fScores
+class FScoreCoordinate {
+  public:
+    FScoreCoordinate(const int& score, const node& coord) : f_score(score), coordinate(coord) {}
+    int f_score;
+    node coordinate;
+
+    FScoreCoordinate& operator=(const FScoreCoordinate& other); // implement assignment operator to work with priority queue
+};
+
+FScoreCoordinate& FScoreCoordinate::operator=(const FScoreCoordinate& other) {
+  if (this == &other) {
+    return *this;
+  }
+
+  this->f_score = other.f_score;
+  this->coordinate = node(other.coordinate.first, other.coordinate.second);
+  return *this;
+}
+
+// FScoreCoordinateComparison is used to represent nodes for the A* algorithm, so they can be sorted in a priority queue by fScores
+class FScoreCoordinateComparison {
+  public:
+    bool operator() (const FScoreCoordinate& l, const FScoreCoordinate& r) const {
+      // want this comparator to act for a min-queue on fScore
+      return l.f_score > r.f_score;
+    }
+};
+
+vector<node> DeterminePath(const map<node,node>& came_from, const node& last_node) {
+  node current_node = last_node;
+  vector<node> path(1, current_node);
+  while (came_from.find(current_node) != came_from.end()) {
+    auto it = came_from.find(current_node);
+    current_node = it->second;
+    path.insert(path.begin(), current_node);
+  }
+
+  return path;
+}
+
+// AdjacentNodes returns a list of coordinates of the adjacent nodes to n
+// For Part 1, this is neighbords immediately above, below, left, and right of n
+// If n is on the edge of the map, the returned listed will be short (only valid map coordinates are returned)
+vector<node> AdjacentNodes(const node& n, const vector<vector<int>>& map) {
+  vector<node> candidates;
+  candidates.push_back(node(n.first-1,n.second));
+  candidates.push_back(node(n.first+1,n.second));
+  candidates.push_back(node(n.first,n.second-1));
+  candidates.push_back(node(n.first,n.second+1));
+
+  vector<node> final;
+  for (auto c:candidates) {
+    if (c.first < 0 || c.first >= map.size()) {
+      continue;
+    }
+    if (c.second < 0 || c.second >= map[c.first].size()) {
+      continue;
+    }
+
+    final.push_back(c);
+  }
+
+  return final;
+}
+
+// AStar implements the A* path-finding algorithm; developed using pseudocode from https://en.wikipedia.org/wiki/A*_search_algorithm#Pseudocode
+// If I use a heuristic function like h(node) = node.x + node.y (since diagonals cannot be used): AStarHeuristic, I believe that means h() is monotone/consistent and we should have an optimal performance over Dijkstra's
+vector<node> AStar(
+  const node& start,
+  const node& end,
+  const vector<vector<int>>& node_map,
+  heuristic_func h
+) {
+  AOC_TIME_SCOPE("day15.astar");
+  // Create queue tracking discovered nodes set to be considered, with their fScores
+  priority_queue<FScoreCoordinate, vector<FScoreCoordinate>, FScoreCoordinateComparison> open_set;
+  int f_score_start = (*h)(start,end);
+  open_set.push(FScoreCoordinate(f_score_start, start));
+
+  // Create map tracking the directionality of the lowest risk path from start
+  map<node,node> came_from;
+
+  // Create map tracking the value of the lowest risk path from start to other nodes
+  map<node,int> g_score;
+  g_score[start] = 0;
+
+  while (!open_set.empty()) {
+    FScoreCoordinate curr = open_set.top(); // node to consider with the lowest fScore
+    if (curr.coordinate == end) {
+      return DeterminePath(came_from, curr.coordinate);
+    }
+
+    open_set.pop(); // remove curr from consideration for the time being
+    AOC_COUNT("day15.astar.expansions", 1);
+    AOC_HISTOGRAM("day15.astar.open_set_size", open_set.size());
+    vector<node> adjacent_coords = AdjacentNodes(curr.coordinate, node_map);
+    for (auto a:adjacent_coords) {
+      int tentative_g_score = g_score[curr.coordinate] + node_map[a.first][a.second]; // cost of moving to the adjacent node is equal to that node's risk level
+      // If the adjacent node does not have a definitive gScore yet, the default is infinity
+      if (g_score.find(a) == g_score.end() || tentative_g_score < g_score[a]) {
+        // this adjacent node is the best option for curr to travel to
+        came_from[a] = curr.coordinate;
+        g_score[a] = tentative_g_score;
+
+        int f_score = tentative_g_score + (*h)(a, end);
+        // "With a consistent heuristic, A* is guaranteed to find an optimal path without processing any node more than once" - so we will not check if the adjacent node is already in open_set before adding it, which would necessitate storing all nodes in open_set in a separate structure
+        open_set.push(FScoreCoordinate(f_score, a));
+        AOC_COUNT("day15.astar.pushes", 1);
+      }
+    }
+  }
+
+  return vector<node>(); // failure case
+}
+
+// NodeMapLowestTotalRisk returns the total risk of the lowest-risk path from the top left to the bottom right of the map, using AStar
+// This was the original solution; GridLowestTotalRisk finds the same answer much faster, so this is kept to compare against
+// Throws logic_error if there is no such path
+int NodeMapLowestTotalRisk(const vector<vector<int>>& risk_map) {
+  // all pairs are represented as (row,col)
+  vector<node> lowest_risk_path = AStar(
+    node(0,0),
+    node(risk_map.size()-1,risk_map[risk_map.size()-1].size()-1),
+    risk_map,
+    &AStarHeuristic);
+  if (lowest_risk_path.size() <= 0) {
+    throw logic_error("algorithm failed to find a path from start to end");
+  }
+
+  int total_risk = 0;
+  for (int i=1; i < lowest_risk_path.size(); ++i) {
+    total_risk += risk_map[lowest_risk_path[i].first][lowest_risk_path[i].second];
+  }
+  return total_risk;
+}
+
+// cell is the index of a map position in row-major order: row * columns + col
+typedef unsigned int cell;
+const cell kNoCell = numeric_limits<cell>::max();
+
+// FlatRiskMap holds the risk levels of a map in one row-major array, so the search can address positions as cells
+class FlatRiskMap {
+  private:
+    int rows;
+    int cols;
+    vector<unsigned char> risk; // every risk level is a single digit
+
+  public:
+    // The map must be rectangular, which Parse checks
+    explicit FlatRiskMap(const vector<vector<int>>& risk_map): rows(risk_map.size()), cols(risk_map[0].size()) {
+      this->risk.resize((size_t)this->rows * this->cols);
+      for (int row = 0; row < this->rows; ++row) {
+        copy(risk_map[row].begin(), risk_map[row].end(), this->risk.begin() + (size_t)row * this->cols);
+      }
+    }
+
+    int Rows() const { return this->rows; }
+    int Cols() const { return this->cols; }
+    int Risk(const int row, const int col) const { return this->risk[(size_t)row * this->cols + col]; }
+};
+
+// TiledRiskMap is the full map for Part 2 without building it: the base map tiled grow_factor times in each direction,
+// with each tile's risk levels one higher (wrapping back around to 1 after 9) than the tile above it or to its left
+// Each risk level is worked out when it is asked for, so the full map takes no memory beyond the base map's,
+// and the search can run over maps far too large to hold (like a grow factor of 500)
+class TiledRiskMap {
+  private:
+    const FlatRiskMap& base;
+    int grow_factor;
+
+  public:
+    TiledRiskMap(const FlatRiskMap& b, const int grow): base(b), grow_factor(grow) {}
+
+    int Rows() const { return this->base.Rows() * this->grow_factor; }
+    int Cols() const { return this->base.Cols() * this->grow_factor; }
+
+    // Stepping to the next tile right or down adds 1; (risk - 1) % 9 + 1 wraps 10 back around to 1
+    int Risk(const int row, const int col) const {
+      const int base_rows = this->base.Rows();
+      const int base_cols = this->base.Cols();
+      const int tile_row = row / base_rows;
+      const int tile_col = col / base_cols;
+      const int base_risk = this->base.Risk(row - tile_row * base_rows, col - tile_col * base_cols);
+      return (base_risk + tile_row + tile_col - 1) % 9 + 1;
+    }
+};
+
+// GridAStar is AStar specialized to a grid: it finds the lowest-risk path from the top left to the bottom right of the map
+// Distances are an array indexed by cell rather than a map keyed by coordinates, and the open set is a queue of cells
+// that can lower a queued cell's key, so a cell whose distance improves is not queued again
+// Only the path's total risk is needed, so no parents are kept to rebuild the path itself, which saves memory on the largest maps
+// The heuristic (the Manhattan distance to the end, since every move costs at least 1) is consistent, so each cell is expanded at most once
+// RiskMap is a FlatRiskMap or TiledRiskMap; Queue is an empty IndexedHeap or BucketQueue with an id for every cell
+// Returns the path's total risk, or a negative number if there is no path
+// Runtime complexity: O(n log n) for n cells with IndexedHeap, or O(n) with BucketQueue, with O(n) memory in the distances and the queue
+template <typename RiskMap, typename Queue>
+int GridAStar(const RiskMap& risk_map, Queue& open_set) {
+  AOC_TIME_SCOPE("day15.grid_astar");
+  const int rows = risk_map.Rows();
+  const int cols = risk_map.Cols();
+  const size_t cell_count = (size_t)rows * cols;
+  const cell start = 0;
+  const cell end = cell_count - 1;
+
+  vector<int> distance(cell_count, numeric_limits<int>::max()); // lowest known risk from start to each cell
+  // open_set is keyed by f-score: distance plus heuristic
+
+  distance[start] = 0;
+  open_set.PushOrDecrease(start, (rows - 1) + (cols - 1));
+
+  const int row_steps[] = { -1, 1, 0, 0 };
+  const int col_steps[] = { 0, 0, -1, 1 };
+  while (!open_set.Empty()) {
+    const cell current = open_set.Pop();
+    if (current == end) {
+      return distance[end];
+    }
+    AOC_COUNT("day15.grid_astar.expansions", 1);
+
+    const int row = current / cols;
+    const int col = current % cols;
+    for (int step = 0; step < 4; ++step) {
+      const int next_row = row + row_steps[step];
+      const int next_col = col + col_steps[step];
+      if (next_row < 0 || next_row >= rows || next_col < 0 || next_col >= cols) {
+        continue;
+      }
+
+      const cell next = (cell)next_row * cols + next_col;
+      const int tentative_distance = distance[current] + risk_map.Risk(next_row, next_col);
+      if (tentative_distance < distance[next]) {
+        distance[next] = tentative_distance;
+        open_set.PushOrDecrease(next, tentative_distance + (rows - 1 - next_row) + (cols - 1 - next_col));
+      }
+    }
+  }
+
+  return -1; // failure case
+}
+
+// kMaxRisk is the highest risk level of a position; a move's cost is the risk level of the position moved to
+const int kMaxRisk = 9;
+
+// GridLowestTotalRisk returns the total risk of the lowest-risk path from the top left to the bottom right of the map,
+// searching with the given grid strategy; threads is the number of threads for parallel_delta_stepping
+// Throws logic_error if there is no such path
+template <typename RiskMap>
+int GridLowestTotalRisk(const RiskMap& risk_map, const SearchStrategy strategy, const unsigned int threads) {
+  const size_t cell_count = (size_t)risk_map.Rows() * risk_map.Cols();
+  if (cell_count >= kNoCell) {
+    throw logic_error("map has too many cells to index");
+  }
+
+  int total_risk;
+  if (strategy == SearchStrategy::parallel_delta_stepping) {
+    ThreadPool pool(threads);
+    total_risk = DeltaStepping(risk_map, pool);
+  }
+  else if (strategy == SearchStrategy::grid_buckets) {
+    // A move raises the f-score by its cost, give or take 1 for the change in the heuristic, so f-scores pushed are within kMaxRisk + 1 of the lowest
+    BucketQueue<cell> open_set(cell_count, kMaxRisk + 2);
+    total_risk = GridAStar(risk_map, open_set);
+  }
+  else {
+    IndexedHeap<int, cell> open_set(cell_count);
+    total_risk = GridAStar(risk_map, open_set);
+  }
+  if (total_risk < 0) {
+    throw logic_error("algorithm failed to find a path from start to end");
+  }
+  return total_risk;
+}
+
+// ExpandMap returns the full map, which is the given map tiled grow_factor times in each direction,
+// with each tile's risk levels one higher (wrapping back around to 1 after 9) than the tile above it or to its left
+vector<vector<int>> ExpandMap(const vector<vector<int>>& initial_map, const int grow_factor) {
+  vector<vector<int>> risk_map = initial_map;
+  int initial_map_rows = initial_map.size();
+  int initial_map_cols = initial_map[0].size();
+
+  // resize map
+  risk_map.resize(initial_map_rows * grow_factor);
+  for (int row = 0; row < risk_map.size(); ++row) {
+    risk_map[row].resize(initial_map_cols * grow_factor);
+  }
+
+  // fill in further values
+  for (int row = 0; row < risk_map.size(); ++row) {
+    for (int col = 0; col < risk_map[row].size(); ++col) {
+      if (row < initial_map_rows && col < initial_map_cols) {
+        continue; // the original values don't change
+      }
+
+      // since the values are getting filled out on a single row, left to right, copy from the left then from above
+      int existing_val;
+      if (row - initial_map_rows < 0) {
+        // copy from the columns to the left
+        existing_val = risk_map[row][col - initial_map_cols];
+      }
+      else {
+        // copy from above since it's already been filled in
+        existing_val = risk_map[row - initial_map_rows][col];
+      }
+
+      risk_map[row][col] = existing_val == 9 ? 1 : existing_val + 1;
+    }
+  }
+
+  return risk_map;
+}
+
+void Day15Solver::Parse(const vector<LineView>& lines) {
+  this->risk_map.resize(lines.size());
+  for (int row = 0; row < lines.size(); ++row) {
+    if (lines[row].size() != lines[0].size()) {
+      throw invalid_argument("row " + to_string(row) + " is not the same length as the first row");
+    }
+    this->risk_map[row].resize(lines[row].size());
+    for (int col = 0; col < lines[row].size(); ++col) {
+      const char c = lines[row][col];
+      if (c < '0' || c > '9') {
+        throw invalid_argument("file value at row " + to_string(row) + ", column " + to_string(col) + " is not a valid int");
+      }
+      this->risk_map[row][col] = c - '0'; // this evaluates to an int representing the number in the char
+    }
+  }
+
+  if (this->risk_map.empty() || this->risk_map[0].empty()) {
+    throw invalid_argument("empty map");
+  }
+}
+
+// kDeltaStepWidth is the range of distances in each of DeltaStepping's buckets
+// It is at least the highest move cost, so every move is "light" and a bucket is just settled again until it stops changing;
+// wider buckets give each round more cells to share between threads, at the cost of relaxing some cells more than once
+const int kDeltaStepWidth = kMaxRisk;
+
+// kDeltaStepChunk is the number of frontier cells each task relaxes; it keeps tasks long enough to be worth handing to a thread
+const size_t kDeltaStepChunk = 4096;
+
+// DeltaStepping finds the lowest total risk from the top left to the bottom right of the map with parallel delta-stepping:
+// cells are kept in buckets by distance, each kDeltaStepWidth wide, and the bucket with the lowest distances is settled by relaxing
+// all of its cells at once, on every thread, in rounds, until no distance in it improves; then the search moves on to the next bucket
+// Distances are atomic, and only ever lowered, so the threads can relax neighboring cells at the same time
+// Its answer is the same as GridAStar's, since a bucket is only left once none of its distances can improve; it stops once
+// the bottom right's bucket is settled
+// Each thread keeps the cells it relaxed in its own lists, which are gathered (without repeats) between rounds
+// RiskMap is a FlatRiskMap or TiledRiskMap; returns a negative number if there is no path
+// Runtime complexity: O(n) work for n cells, plus re-relaxations within a bucket, shared between the pool's threads; O(n) memory
+template <typename RiskMap>
+int DeltaStepping(const RiskMap& risk_map, ThreadPool& pool) {
+  AOC_TIME_SCOPE("day15.delta_stepping");
+  const int rows = risk_map.Rows();
+  const int cols = risk_map.Cols();
+  const size_t cell_count = (size_t)rows * cols;
+  const cell end = cell_count - 1;
+
+  // A move costs at most kMaxRisk, so a cell relaxed from bucket b lands in bucket b up to b + kMaxRisk / width + 1:
+  // that many buckets, kept round a circle, hold every distance that is queued at once
+  const int bucket_span = kMaxRisk / kDeltaStepWidth + 2;
+
+  vector<atomic<int>> distance(cell_count);
+  for (size_t c = 0; c < cell_count; ++c) {
+    distance[c].store(numeric_limits<int>::max(), memory_order_relaxed);
+  }
+  vector<unsigned int> gathered_round(cell_count, 0); // the last round each cell was gathered into the frontier, to skip repeats
+
+  // ThreadLists are the cells one thread relaxed: into the bucket being settled, or into a later bucket
+  class ThreadLists {
+    public:
+      vector<cell> current;
+      vector<vector<cell>> later;
+  };
+  const unsigned int threads = pool.ThreadCount();
+  vector<ThreadLists> lists(threads + 1); // the last lists are for the calling thread, which is not one of the pool's workers
+  for (auto& l:lists) {
+    l.later.resize(bucket_span);
+  }
+
+  distance[0].store(0, memory_order_relaxed);
+  vector<cell> frontier(1, 0);
+  unsigned int round = 1;
+  gathered_round[0] = round;
+  long long int bucket = 0;
+
+  // gather collects the cells that are still in the bucket being settled into the frontier, once each,
+  // from every thread's current list, or from every thread's later list for the given slot (if it is not negative)
+  // Copies of cells whose distances have since dropped out of the bucket are skipped
+  auto gather = [&](const int later_slot) {
+    ++round;
+    frontier.clear();
+    for (auto& l:lists) {
+      vector<cell>& from = later_slot < 0 ? l.current : l.later[later_slot];
+      for (auto c:from) {
+        if (gathered_round[c] != round && distance[c].load(memory_order_relaxed) / kDeltaStepWidth == bucket) {
+          gathered_round[c] = round;
+          frontier.push_back(c);
+        }
+      }
+      from.clear();
+    }
+  };
+
+  // relax relaxes every neighbor of the frontier's cells in [first, last), filing each improved neighbor in the running thread's lists
+  auto relax = [&](const size_t first, const size_t last) {
+    const int worker = pool.CurrentWorker();
+    ThreadLists& mine = lists[worker < 0 ? threads : worker];
+    const int row_steps[] = { -1, 1, 0, 0 };
+    const int col_steps[] = { 0, 0, -1, 1 };
+    for (size_t i = first; i < last; ++i) {
+      const cell current = frontier[i];
+      const int current_distance = distance[current].load(memory_order_relaxed);
+      const int row = current / cols;
+      const int col = current % cols;
+      for (int step = 0; step < 4; ++step) {
+        const int next_row = row + row_steps[step];
+        const int next_col = col + col_steps[step];
+        if (next_row < 0 || next_row >= rows || next_col < 0 || next_col >= cols) {
+          continue;
+        }
+
+        const cell next = (cell)next_row * cols + next_col;
+        const int tentative_distance = current_distance + risk_map.Risk(next_row, next_col);
+        int seen = distance[next].load(memory_order_relaxed);
+        while (tentative_distance < seen && !distance[next].compare_exchange_weak(seen, tentative_distance, memory_order_relaxed)) {}
+        if (tentative_distance >= seen) {
+          continue; // another path to next is at least as good
+        }
+
+        const long long int next_bucket = tentative_distance / kDeltaStepWidth;
+        if (next_bucket == bucket) {
+          mine.current.push_back(next);
+        }
+        else {
+          mine.later[next_bucket % bucket_span].push_back(next);
+        }
+      }
+    }
+  };
+
+  while (true) {
+    // Settle the bucket: relax its cells in rounds until none of its distances improve
+    while (!frontier.empty()) {
+      AOC_COUNT("day15.delta_stepping.rounds", 1);
+      AOC_HISTOGRAM("day15.delta_stepping.frontier_size", frontier.size());
+      for (size_t first = 0; first < frontier.size(); first += kDeltaStepChunk) {
+        const size_t last = min(frontier.size(), first + kDeltaStepChunk);
+        pool.Submit([&relax, first, last]() { relax(first, last); });
+      }
+      pool.Wait();
+      gather(-1);
+    }
+
+    // The bottom right is settled once its bucket is; otherwise, move on to the next bucket with cells in it
+    const int end_distance = distance[end].load();
+    if (end_distance / kDeltaStepWidth <= bucket) {
+      return end_distance;
+    }
+
+    bool any_later = false;
+    for (auto& l:lists) {
+      for (auto& later:l.later) {
+        any_later = any_later || !later.empty();
+      }
+    }
+    if (!any_later) {
+      return -1; // failure case: nothing left to relax, and the bottom right was never reached
+    }
+
+    ++bucket;
+    gather(bucket % bucket_span);
+  }
+}
+
+// The original search needs the full map built; the grid searches tile the map as they go
+int LowestTotalRisk(const vector<vector<int>>& risk_map, const int grow_factor, const SearchStrategy strategy, const unsigned int threads) {
+  if (grow_factor < 1) {
+    throw logic_error("grow factor must be at least 1");
+  }
+  if (strategy == SearchStrategy::node_map) {
+    return NodeMapLowestTotalRisk(grow_factor == 1 ? risk_map : ExpandMap(risk_map, grow_factor));
+  }
+
+  const FlatRiskMap base(risk_map);
+  if (grow_factor == 1) {
+    return GridLowestTotalRisk(base, strategy, threads);
+  }
+  if ((long long int)base.Rows() * grow_factor > numeric_limits<int>::max() || (long long int)base.Cols() * grow_factor > numeric_limits<int>::max()) {
+    throw logic_error("map has too many cells to index");
+  }
+  return GridLowestTotalRisk(TiledRiskMap(base, grow_factor), strategy, threads);
+}
+
+int Day15Solver::SolvePart1() {
+  return LowestTotalRisk(this->risk_map, 1, this->strategy, this->threads);
+}
+
+int Day15Solver::SolvePart2() {
+  return LowestTotalRisk(this->risk_map, 5, this->strategy, this->threads);
+}
+
+} // namespace day15
@@ -0,0 +1,50 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 15 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: What is the lowest total risk of any path from the top left to the bottom right?
+// Part 2: Using the full map, what is the lowest total risk of any path from the top left to the bottom right?
+
+#ifndef DAY15_SOLVER_HPP_
+#define DAY15_SOLVER_HPP_
+
+#include "../util/solver.hpp" // Solver
+#include <vector>
+
+namespace day15 {
+
+// SearchStrategy selects how the lowest-risk path is searched for
+//   node_map is the original AStar, with distances kept in maps keyed by coordinates and a priority queue that keeps stale entries
+//   grid_heap searches a flat grid with an indexed 4-ary heap
+//   grid_buckets searches a flat grid with a circular bucket queue (Dial's algorithm), since every move costs 1 to 9
+//   parallel_delta_stepping settles a flat grid's cells in buckets of nearby distances, sharing each bucket between threads;
+//   it is for very large maps, since each round of a bucket waits for all of the threads
+enum class SearchStrategy { node_map=0, grid_heap=1, grid_buckets=2, parallel_delta_stepping=3 };
+
+// LowestTotalRisk returns the total risk of the lowest-risk path from the top left to the bottom right of the full map:
+// the rectangular risk_map tiled grow_factor times in each direction, as in Part 2 (a grow_factor of 1 is the map itself)
+// The grid strategies never build the full map, so only their search state grows with the grow factor
+// threads is the number of threads parallel_delta_stepping uses; 0 uses one per hardware thread, and the other strategies use one
+// Throws std::logic_error if there is no such path, or the full map is too large to index
+int LowestTotalRisk(const std::vector<std::vector<int>>& risk_map, const int grow_factor, const SearchStrategy strategy, const unsigned int threads=0);
+
+// ExpandMap returns the full map, which is the given map tiled grow_factor times in each direction,
+// with each tile's risk levels one higher (wrapping back around to 1 after 9) than the tile above it or to its left
+std::vector<std::vector<int>> ExpandMap(const std::vector<std::vector<int>>& initial_map, const int grow_factor);
+
+class Day15Solver : public Solver<int, int> {
+  private:
+    std::vector<std::vector<int>> risk_map; // accessed like [row][col]
+    SearchStrategy strategy;
+    unsigned int threads;
+
+  public:
+    explicit Day15Solver(const SearchStrategy s=SearchStrategy::grid_buckets, const unsigned int t=0): strategy(s), threads(t) {}
+
+    void Parse(const std::vector<LineView>& lines);
+    int SolvePart1();
+    int SolvePart2();
+};
+
+} // namespace day15
+
+#endif // DAY15_SOLVER_HPP_
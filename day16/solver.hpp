@@ -0,0 +1,37 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 16 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: What do you get if you add up the version numbers in all packets?
+// Part 2: What do you get if you evaluate the expression represented by your hexadecimal-encoded BITS transmission?
+
+#ifndef DAY16_SOLVER_HPP_
+#define DAY16_SOLVER_HPP_
+
+#include "../util/solver.hpp" // Solver
+#include <vector>
+
+namespace day16 {
+
+class Packet;
+
+class Day16Solver : public Solver<unsigned int, unsigned long long int> {
+  private:
+    Packet* outer_packet;
+
+    // the packets are owned by exactly one solver, so copying is not allowed
+    Day16Solver(const Day16Solver& other);
+    Day16Solver& operator=(const Day16Solver& other);
+
+  public:
+    Day16Solver(): outer_packet(NULL) {}
+
+    void Parse(const std::vector<LineView>& lines);
+    unsigned int SolvePart1();
+    unsigned long long int SolvePart2();
+
+    ~Day16Solver();
+};
+
+} // namespace day16
+
+#endif // DAY16_SOLVER_HPP_
@@ -0,0 +1,29 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 17 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: What is the highest y position it reaches on this trajectory?
+// Part 2: How many distinct initial velocity values cause the probe to be within the target area after any step?
+
+#ifndef DAY17_SOLVER_HPP_
+#define DAY17_SOLVER_HPP_
+
+#include "../util/solver.hpp" // Solver
+#include <utility>
+#include <vector>
+
+namespace day17 {
+
+class Day17Solver : public Solver<int, int> {
+  private:
+    // ordered by (min_x, max_x), (min_y, max_y)
+    std::pair<std::pair<int,int>, std::pair<int,int>> target_area;
+
+  public:
+    void Parse(const std::vector<LineView>& lines);
+    int SolvePart1();
+    int SolvePart2();
+};
+
+} // namespace day17
+
+#endif // DAY17_SOLVER_HPP_
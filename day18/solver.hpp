@@ -0,0 +1,37 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 18 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: What is the magnitude of the final sum?
+// Part 2: What is the largest magnitude of any sum of two different snailfish numbers from the homework assignment?
+
+#ifndef DAY18_SOLVER_HPP_
+#define DAY18_SOLVER_HPP_
+
+#include "../util/solver.hpp" // Solver
+#include <vector>
+
+namespace day18 {
+
+class SnailfishNumberElement;
+
+class Day18Solver : public Solver<long long int, long long int> {
+  private:
+    std::vector<SnailfishNumberElement*> numbers_to_add; // the parts add copies, so these are never changed once parsed
+
+    // the numbers are owned by exactly one solver, so copying is not allowed
+    Day18Solver(const Day18Solver& other);
+    Day18Solver& operator=(const Day18Solver& other);
+
+  public:
+    Day18Solver() {}
+
+    void Parse(const std::vector<LineView>& lines);
+    long long int SolvePart1();
+    long long int SolvePart2();
+
+    ~Day18Solver();
+};
+
+} // namespace day18
+
+#endif // DAY18_SOLVER_HPP_
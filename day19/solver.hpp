@@ -0,0 +1,42 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 19 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: How many beacons are there?
+// Part 2: What is the largest Manhattan distance between any two scanners?
+
+#ifndef DAY19_SOLVER_HPP_
+#define DAY19_SOLVER_HPP_
+
+#include "../util/solver.hpp" // Solver
+#include <vector>
+
+namespace day19 {
+
+class ScannerBeaconSet;
+class Universe;
+
+class Day19Solver : public Solver<int, int> {
+  private:
+    std::vector<ScannerBeaconSet*> unmerged_scanners; // Part 1 merges these into full_space
+    Universe* full_space;
+
+    // the scanners are owned by exactly one solver, so copying is not allowed
+    Day19Solver(const Day19Solver& other);
+    Day19Solver& operator=(const Day19Solver& other);
+
+  public:
+    Day19Solver(): full_space(NULL) {}
+
+    void Parse(const std::vector<LineView>& lines);
+    int SolvePart1();
+    int SolvePart2();
+
+    // Part 2 measures between the scanners as placed by Part 1
+    bool Part2DependsOnPart1() const { return true; }
+
+    ~Day19Solver();
+};
+
+} // namespace day19
+
+#endif // DAY19_SOLVER_HPP_
@@ -0,0 +1,41 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 20 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: Applying the image enhancement algorithm twice, how many pixels are lit in the resulting image?
+// Part 2: Applying the image enhancement algorithm 50 times, how many pixels are lit in the resulting image?
+
+#ifndef DAY20_SOLVER_HPP_
+#define DAY20_SOLVER_HPP_
+
+#include "../util/solver.hpp" // Solver
+#include <vector>
+
+namespace day20 {
+
+class PuzzleInput;
+
+class Day20Solver : public Solver<int, int> {
+  private:
+    PuzzleInput* input;
+    int applications_done;
+
+    // the parsed input is owned by exactly one solver, so copying is not allowed
+    Day20Solver(const Day20Solver& other);
+    Day20Solver& operator=(const Day20Solver& other);
+
+  public:
+    Day20Solver(): input(NULL), applications_done(0) {}
+
+    void Parse(const std::vector<LineView>& lines);
+    int SolvePart1();
+    int SolvePart2();
+
+    // Part 2 carries on enhancing the image that Part 1 enhanced
+    bool Part2DependsOnPart1() const { return true; }
+
+    ~Day20Solver();
+};
+
+} // namespace day20
+
+#endif // DAY20_SOLVER_HPP_
@@ -0,0 +1,28 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 21 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: What do you get if you multiply the score of the losing player by the number of times the die was rolled during the game?
+// Part 2: Find the player that wins in more universes; in how many universes does that player win?
+
+#ifndef DAY21_SOLVER_HPP_
+#define DAY21_SOLVER_HPP_
+
+#include "../util/solver.hpp" // Solver
+#include <utility>
+#include <vector>
+
+namespace day21 {
+
+class Day21Solver : public Solver<int, unsigned long long int> {
+  private:
+    std::vector<std::pair<int,int>> starting_positions; // (player number, starting position) of each player
+
+  public:
+    void Parse(const std::vector<LineView>& lines);
+    int SolvePart1();
+    unsigned long long int SolvePart2();
+};
+
+} // namespace day21
+
+#endif // DAY21_SOLVER_HPP_
@@ -0,0 +1,37 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 22 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: Considering only cubes in the region x=-50..50,y=-50..50,z=-50..50, how many cubes are on?
+// Part 2: Considering all cubes, how many cubes are on?
+
+#ifndef DAY22_SOLVER_HPP_
+#define DAY22_SOLVER_HPP_
+
+#include "../util/solver.hpp" // Solver
+#include <vector>
+
+namespace day22 {
+
+class PuzzleInput;
+
+class Day22Solver : public Solver<int, unsigned long long int> {
+  private:
+    PuzzleInput* input;
+
+    // the parsed input is owned by exactly one solver, so copying is not allowed
+    Day22Solver(const Day22Solver& other);
+    Day22Solver& operator=(const Day22Solver& other);
+
+  public:
+    Day22Solver(): input(NULL) {}
+
+    void Parse(const std::vector<LineView>& lines);
+    int SolvePart1();
+    unsigned long long int SolvePart2();
+
+    ~Day22Solver();
+};
+
+} // namespace day22
+
+#endif // DAY22_SOLVER_HPP_
@@ -0,0 +1,832 @@
+// solver.cpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 23 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: What is the least energy required to organize the amphipods?
+// Part 2: Using the initial configuration from the full diagram, what is the least energy required to organize the amphipods?
+
+#include "solver.hpp"
+#include "../util/instrument.hpp" // AOC_TIME_SCOPE, AOC_COUNT, AOC_HISTOGRAM
+#include "../util/indexedheap.hpp" // IndexedHeap
+#include "../util/threadpool.hpp" // ThreadPool
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <stdexcept>
+#include <limits>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+
+using namespace std;
+
+namespace day23 {
+
+// Amphipods are typed by letter from 'A', and each type belongs in the room of the same index, counting from the left
+const char kAmphipodChars[] = "ABCDEFG";
+
+// Each cell of the burrow is packed into kCellBits bits of a BurrowState's words: 0 if the cell is empty, or 1 more than the type of the amphipod in it
+// A cell never straddles two words, so kCellsPerWord fit in each
+typedef unsigned long long int burrow_word;
+const int kCellBits = 3;
+const int kCellMask = (1 << kCellBits) - 1;
+const int kCellsPerWord = 64 / kCellBits;
+const int kMaxTypes = kCellMask;
+
+// BurrowDiagram is a burrow as drawn in a diagram, before it is packed into the BurrowState for its shape
+class BurrowDiagram {
+  public:
+    int hallway_length;
+    vector<int> room_entrances; // hallway index just outside each room
+    vector<vector<int>> rooms; // type of each amphipod in each room, from the top down
+
+    int RoomCount() const { return this->rooms.size(); }
+    int RoomDepth() const { return this->rooms.empty() ? 0 : this->rooms[0].size(); }
+};
+
+// A hallway_mask has bit h set for hallway index h
+typedef unsigned int hallway_mask;
+
+// A move_code is the cell an amphipod moves from, shifted up by kMoveCodeBits, joined with the cell it moves to
+typedef unsigned short move_code;
+const int kMoveCodeBits = 8;
+const int kMoveCodeMask = (1 << kMoveCodeBits) - 1;
+
+// BurrowTables are worked out at compile time for each shape of burrow: Rooms rooms, Depth deep, under a hallway Hallway long
+// The rooms are spread evenly along the middle of the hallway, with one cell between each, as in the puzzle
+template <int Rooms, int Hallway>
+class BurrowTables {
+  public:
+    int room_entrances[Rooms]; // hallway index just outside each room
+    bool outside_room[Hallway]; // whether each hallway index is just outside a room, where amphipods cannot stop
+    int stops[Hallway]; // the hallway indexes that are not outside a room, where amphipods can stop, from the left
+    int stop_count;
+    int hallway_distance[Rooms][Hallway]; // steps from just outside each room to each hallway index
+    hallway_mask path[Rooms][Hallway]; // the hallway cells from just outside each room to each hallway index, both included, which a move between them walks through
+    int energy_per_step[Rooms]; // for each type of amphipod
+};
+
+template <int Rooms, int Hallway>
+constexpr BurrowTables<Rooms, Hallway> BuildBurrowTables() {
+  BurrowTables<Rooms, Hallway> tables{};
+  int energy_per_step = 1;
+  for (int room = 0; room < Rooms; ++room) {
+    tables.room_entrances[room] = (Hallway - (2 * Rooms - 1)) / 2 + 2 * room;
+    tables.outside_room[tables.room_entrances[room]] = true;
+    tables.energy_per_step[room] = energy_per_step;
+    energy_per_step *= 10;
+  }
+  for (int h = 0; h < Hallway; ++h) {
+    if (!tables.outside_room[h]) {
+      tables.stops[tables.stop_count++] = h;
+    }
+  }
+  for (int room = 0; room < Rooms; ++room) {
+    for (int h = 0; h < Hallway; ++h) {
+      const int entrance = tables.room_entrances[room];
+      tables.hallway_distance[room][h] = h < entrance ? entrance - h : h - entrance;
+      for (int path_h = h < entrance ? h : entrance; path_h <= (h < entrance ? entrance : h); ++path_h) {
+        tables.path[room][h] |= (hallway_mask)1 << path_h;
+      }
+    }
+  }
+  return tables;
+}
+
+// BurrowState is where every amphipod in a burrow of one shape is, packed into a few words
+// Cells are numbered along the hallway from the left, then down each room in turn from the top
+// The shape is fixed at compile time, so every loop over the hallway or the rooms has a constant count, and the tables are constants
+template <int Rooms, int Depth, int Hallway>
+class BurrowState {
+  public:
+    static const int kRooms = Rooms;
+    static const int kDepth = Depth;
+    static const int kHallway = Hallway;
+    static const int kCells = Hallway + Rooms * Depth;
+    static const int kWords = (kCells + kCellsPerWord - 1) / kCellsPerWord;
+    static constexpr BurrowTables<Rooms, Hallway> kTables = BuildBurrowTables<Rooms, Hallway>();
+
+    static_assert(Rooms >= 1 && Rooms <= kMaxTypes, "each type of amphipod must fit in a cell");
+    static_assert(Depth >= 1, "rooms must have space for amphipods");
+    static_assert(Hallway >= 2 * Rooms + 1, "hallway must reach over every room, with a cell to stop on between each");
+    static_assert(Hallway <= 8 * sizeof(hallway_mask), "hallway must fit in a mask");
+    static_assert(kCells <= kMoveCodeMask + 1, "cells must fit in a move code");
+
+  private:
+    burrow_word words[kWords];
+
+    static int RoomCell(const int room, const int slot) { return Hallway + room * Depth + slot; }
+
+    // RoomTop returns the slot of the top amphipod in the room, or the room depth if the room is empty
+    int RoomTop(const int room) const {
+      int slot = 0;
+      while (slot < Depth && this->Cell(RoomCell(room, slot)) == 0) {
+        ++slot;
+      }
+      return slot;
+    }
+
+    // whether fully or not
+    bool IsRoomCorrectlyOccupied(const int room) const {
+      for (int slot = 0; slot < Depth; ++slot) {
+        const int contents = this->Cell(RoomCell(room, slot));
+        if (contents != 0 && contents != room + 1) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    void SetCell(const int cell, const int contents) {
+      burrow_word& word = this->words[cell / kCellsPerWord];
+      const int shift = cell % kCellsPerWord * kCellBits;
+      word = (word & ~((burrow_word)kCellMask << shift)) | ((burrow_word)contents << shift);
+    }
+
+  public:
+    // Transition is a state one move away from another, with the energy the move takes, and the move itself
+    class Transition {
+      public:
+        BurrowState state;
+        int energy;
+        move_code move;
+
+        Transition(const BurrowState& s, const int e, const int from, const int to): state(s), energy(e), move((from << kMoveCodeBits) | to) {}
+    };
+
+    BurrowState() {
+      for (int w = 0; w < kWords; ++w) {
+        this->words[w] = 0;
+      }
+    }
+
+    // Initialization constructor from a parsed diagram, which must be of this shape
+    explicit BurrowState(const BurrowDiagram& diagram): BurrowState() {
+      if (diagram.hallway_length != Hallway || diagram.RoomCount() != Rooms || diagram.RoomDepth() != Depth) {
+        throw invalid_argument("diagram is not of the burrow shape it is searched as");
+      }
+      for (int room = 0; room < Rooms; ++room) {
+        if (diagram.room_entrances[room] != kTables.room_entrances[room]) {
+          throw invalid_argument("rooms must be spread evenly along the middle of the hallway");
+        }
+        for (int slot = 0; slot < Depth; ++slot) {
+          this->SetCell(RoomCell(room, slot), diagram.rooms[room][slot] + 1);
+        }
+      }
+    }
+
+    // Cell returns 0 if the cell is empty, or 1 more than the type of the amphipod in it
+    int Cell(const int cell) const { return (int)(this->words[cell / kCellsPerWord] >> (cell % kCellsPerWord * kCellBits)) & kCellMask; }
+
+    // HallwayOccupancy returns the mask of the hallway cells with amphipods in them
+    hallway_mask HallwayOccupancy() const {
+      hallway_mask occupied = 0;
+      for (int h = 0; h < Hallway; ++h) {
+        occupied |= (hallway_mask)(this->Cell(h) != 0) << h;
+      }
+      return occupied;
+    }
+
+    // Moved returns this state with the amphipod in one cell moved to another, empty cell
+    BurrowState Moved(const int from, const int to) const {
+      BurrowState moved(*this);
+      moved.SetCell(to, this->Cell(from));
+      moved.SetCell(from, 0);
+      return moved;
+    }
+
+    // Organized returns the state with every amphipod in its own room
+    static BurrowState Organized() {
+      BurrowState organized;
+      for (int room = 0; room < Rooms; ++room) {
+        for (int slot = 0; slot < Depth; ++slot) {
+          organized.SetCell(RoomCell(room, slot), room + 1);
+        }
+      }
+      return organized;
+    }
+
+    // Fingerprint mixes every bit of the state into a hash, spread well enough that its top bits pick a hash table slot
+    unsigned long long int Fingerprint() const {
+      unsigned long long int hash = 0;
+      for (int w = 0; w < kWords; ++w) {
+        hash = (hash ^ this->words[w]) * 0x9E3779B97F4A7C15ULL;
+        hash ^= hash >> 32;
+      }
+      hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+      return hash ^ (hash >> 31);
+    }
+
+    bool operator==(const BurrowState& other) const {
+      for (int w = 0; w < kWords; ++w) {
+        if (this->words[w] != other.words[w]) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    // EnergyNeededHeuristic never overestimates: it counts each amphipod that still has to move walking straight to its own room, ignoring the others,
+    // climbing out of the room it is in first, and then down into its own room, where the amphipods of a type that still have to come in fill it from the bottom of
+    // the space left, so between them they walk 1, 2, and so on down to it
+    int EnergyNeededHeuristic() const {
+      int min_energy_needed = 0;
+      int arriving[Rooms] = {}; // amphipods of each type that still have to come into their room
+
+      // Check hallway
+      for (int h = 0; h < Hallway; ++h) {
+        const int contents = this->Cell(h);
+        if (contents != 0) {
+          min_energy_needed += kTables.hallway_distance[contents-1][h] * kTables.energy_per_step[contents-1];
+          ++arriving[contents-1];
+        }
+      }
+
+      // Check rooms; the amphipods of the room's own type below any of another type are already in place
+      for (int room = 0; room < Rooms; ++room) {
+        int in_place = Depth;
+        while (in_place > 0 && this->Cell(RoomCell(room, in_place-1)) == room + 1) {
+          --in_place;
+        }
+        for (int slot = 0; slot < in_place; ++slot) {
+          const int contents = this->Cell(RoomCell(room, slot));
+          if (contents != 0) {
+            // an amphipod leaving its own room has to step aside into the hallway and back
+            const int hallway_steps = contents == room + 1 ? 2 : kTables.hallway_distance[contents-1][kTables.room_entrances[room]];
+            min_energy_needed += (slot + 1 + hallway_steps) * kTables.energy_per_step[contents-1];
+            ++arriving[contents-1];
+          }
+        }
+      }
+
+      for (int type = 0; type < Rooms; ++type) {
+        min_energy_needed += arriving[type] * (arriving[type] + 1) / 2 * kTables.energy_per_step[type];
+      }
+      return min_energy_needed;
+    }
+
+    bool IsOrganized(const BurrowState& organized) const { return *this == organized; }
+
+    // GetValidAdjacentStates sets transitions to each state one move away, with the energy the move takes
+    // An amphipod moves from the top of a room that still holds a wrong type out to a hallway cell, or from the hallway all the way into its own room
+    // If an amphipod in the hallway can go into its room, that is the only move given: going in now costs the same as going in later
+    // (its type fills the same slots either way), and only clears the hallway for the others, so some cheapest path always makes it next
+    // A move is open if none of the hallway cells on its path are occupied, which is one AND of the hallway's occupancy with the path's mask
+    void GetValidAdjacentStates(vector<Transition>& transitions) const {
+      transitions.clear();
+
+      const hallway_mask occupied = this->HallwayOccupancy();
+      int tops[Rooms];
+      bool correctly_occupied[Rooms];
+      for (int room = 0; room < Rooms; ++room) {
+        tops[room] = this->RoomTop(room);
+        correctly_occupied[room] = this->IsRoomCorrectlyOccupied(room);
+      }
+
+      // See where each amphipod in the hallway could move
+      // The room must contain only correct types before we can enter it, and the hallway must be empty on our way there
+      for (hallway_mask left = occupied; left != 0; left &= left - 1) {
+        const int h = __builtin_ctz(left);
+        const int room = this->Cell(h) - 1;
+        if (correctly_occupied[room] && (kTables.path[room][h] & occupied) == ((hallway_mask)1 << h)) {
+          const int to = RoomCell(room, tops[room]-1);
+          transitions.push_back(Transition(this->Moved(h, to), (kTables.hallway_distance[room][h] + tops[room]) * kTables.energy_per_step[room], h, to));
+          return;
+        }
+      }
+
+      // See where each top amphipod on each room could move
+      // Do not consider rooms that are already getting filled up with their correct occupants
+      for (int room = 0; room < Rooms; ++room) {
+        if (tops[room] == Depth || correctly_occupied[room] || (occupied & ((hallway_mask)1 << kTables.room_entrances[room])) != 0) {
+          continue;
+        }
+
+        const int from = RoomCell(room, tops[room]);
+        const int energy_per_step = kTables.energy_per_step[this->Cell(from)-1];
+        // can't move past another amphipod in the hallway, or stop on a space immediately outside any room
+        for (int s = 0; s < kTables.stop_count; ++s) {
+          const int h = kTables.stops[s];
+          if ((kTables.path[room][h] & occupied) == 0) {
+            transitions.push_back(Transition(this->Moved(from, h), (tops[room] + 1 + kTables.hallway_distance[room][h]) * energy_per_step, from, h));
+          }
+        }
+      }
+    }
+
+    // DescribeMove returns the move that made this state from the one before it
+    BurrowMove DescribeMove(const move_code move) const {
+      const int from = move >> kMoveCodeBits;
+      const int to = move & kMoveCodeMask;
+      const int type = this->Cell(to) - 1;
+
+      // every move is between the hallway and a room, and walks from the room's slot up to just outside it, then along the hallway
+      const int hallway_cell = from < Hallway ? from : to;
+      const int room_cell = from < Hallway ? to : from;
+      const int room = (room_cell - Hallway) / Depth;
+      const int steps = (room_cell - Hallway) % Depth + 1 + kTables.hallway_distance[room][hallway_cell];
+
+      BurrowMove described;
+      described.amphipod = kAmphipodChars[type];
+      described.from = CellName(from);
+      described.to = CellName(to);
+      described.energy = steps * kTables.energy_per_step[type];
+      return described;
+    }
+
+    // CellName names a hallway cell by its index from the left, and a room cell by the type that belongs in the room
+    static string CellName(const int cell) {
+      if (cell < Hallway) {
+        return "hallway " + to_string(cell);
+      }
+      return string("room ") + kAmphipodChars[(cell - Hallway) / Depth];
+    }
+
+    // Print writes the state as a diagram like the puzzle input
+    void Print(ostream& os) const {
+      os << string(Hallway + 2, '#') << endl;
+      os << '#';
+      for (int h = 0; h < Hallway; ++h) {
+        os << (this->Cell(h) == 0 ? '.' : kAmphipodChars[this->Cell(h)-1]);
+      }
+      os << '#' << endl;
+
+      for (int slot = 0; slot < Depth; ++slot) {
+        // the top line of rooms is walled all the way across, the lines below only around the rooms
+        string line(Hallway + 2, slot == 0 ? '#' : ' ');
+        for (int room = 0; room < Rooms; ++room) {
+          const int col = kTables.room_entrances[room] + 1;
+          const int contents = this->Cell(RoomCell(room, slot));
+          line[col-1] = '#';
+          line[col] = contents == 0 ? '.' : kAmphipodChars[contents-1];
+          line[col+1] = '#';
+        }
+        os << line << endl;
+      }
+
+      string bottom(Hallway + 2, ' ');
+      for (int room = 0; room < Rooms; ++room) {
+        bottom.replace(kTables.room_entrances[room], 3, "###");
+      }
+      os << bottom.substr(0, bottom.find_last_not_of(' ') + 1) << endl;
+    }
+};
+
+template <int Rooms, int Depth, int Hallway>
+constexpr BurrowTables<Rooms, Hallway> BurrowState<Rooms, Depth, Hallway>::kTables;
+
+// ParseBurrow returns the burrow drawn in the diagram
+// assumes burrow is represented with buffering lines/characters, with all amphipods starting in rooms; example:
+// #############
+// #...........#
+// ###B#A#A#D###
+//   #D#C#B#A#
+//   #D#B#A#C#
+//   #D#C#B#C#
+//   #########
+BurrowDiagram ParseBurrow(const vector<string>& diagram) {
+  if (diagram.size() < 4) {
+    throw invalid_argument("unexpected diagram height");
+  }
+
+  // The hallway is the open cells on the second line
+  const size_t hallway_start = diagram[1].find('.');
+  const size_t hallway_end = diagram[1].find_last_of('.');
+  if (hallway_start == string::npos || diagram[1].find_first_not_of('.', hallway_start) <= hallway_end) {
+    throw invalid_argument("hallway must be a single run of open cells");
+  }
+  BurrowDiagram burrow;
+  burrow.hallway_length = hallway_end - hallway_start + 1;
+
+  // Each line below that with amphipods in it is one slot deeper into the rooms; the first one says where the rooms are
+  vector<string> room_lines;
+  for (int line = 2; line < diagram.size(); ++line) {
+    if (diagram[line].find_first_of(kAmphipodChars) != string::npos) {
+      room_lines.push_back(diagram[line]);
+    }
+  }
+  if (room_lines.empty()) {
+    throw invalid_argument("diagram has no amphipods in rooms");
+  }
+  for (size_t col = room_lines[0].find_first_of(kAmphipodChars); col != string::npos; col = room_lines[0].find_first_of(kAmphipodChars, col+1)) {
+    if (col < hallway_start || col > hallway_end) {
+      throw invalid_argument("room is not below the hallway");
+    }
+    burrow.room_entrances.push_back(col - hallway_start);
+  }
+
+  // There is a room for each type, so the types are the first letters, one per room
+  const int room_count = burrow.room_entrances.size();
+  if (room_count > kMaxTypes) {
+    throw invalid_argument("burrow has more rooms than there are types of amphipod");
+  }
+  burrow.rooms.assign(room_count, vector<int>(room_lines.size()));
+  vector<int> type_counts(room_count, 0);
+  for (int slot = 0; slot < room_lines.size(); ++slot) {
+    for (int room = 0; room < room_count; ++room) {
+      const size_t col = hallway_start + burrow.room_entrances[room];
+      const char c = col < room_lines[slot].size() ? room_lines[slot][col] : '#';
+      if (c < 'A' || c >= 'A' + room_count) {
+        throw invalid_argument("rooms must be full of amphipods of the burrow's types, lined up under each other");
+      }
+      burrow.rooms[room][slot] = c - 'A';
+      ++type_counts[c - 'A'];
+    }
+  }
+  for (auto count:type_counts) {
+    if (count != burrow.RoomDepth()) {
+      throw invalid_argument("there must be exactly enough amphipods of each type to fill their room");
+    }
+  }
+
+  return burrow;
+}
+
+typedef unsigned int state_id;
+const state_id kNoState = numeric_limits<state_id>::max();
+
+// BurrowStateIndex numbers the burrow states a search finds, in the order it finds them, so the search can keep everything else about them in vectors
+// It is an open-addressing hash table of ids keyed on the states' fingerprints, probing linearly, and doubling once it is half full
+template <typename State>
+class BurrowStateIndex {
+  private:
+    vector<State> states; // indexed by id
+    vector<state_id> slots; // the id in each slot, or kNoState
+    int slot_bits;
+
+    size_t Slot(const State& state) const { return state.Fingerprint() >> (64 - this->slot_bits); }
+
+    void Grow() {
+      ++this->slot_bits;
+      this->slots.assign((size_t)1 << this->slot_bits, kNoState);
+      const size_t slot_mask = this->slots.size() - 1;
+      for (state_id id = 0; id < this->states.size(); ++id) {
+        size_t slot = this->Slot(this->states[id]);
+        while (this->slots[slot] != kNoState) {
+          slot = (slot + 1) & slot_mask;
+        }
+        this->slots[slot] = id;
+      }
+    }
+
+  public:
+    BurrowStateIndex(): slots((size_t)1 << 16, kNoState), slot_bits(16) {}
+
+    size_t Size() const { return this->states.size(); }
+    const State& Get(const state_id id) const { return this->states[id]; }
+
+    // FindOrAdd returns the id of the state, numbering it next if it has not been seen before
+    state_id FindOrAdd(const State& state) {
+      const size_t slot_mask = this->slots.size() - 1;
+      size_t slot = this->Slot(state);
+      while (this->slots[slot] != kNoState) {
+        if (this->states[this->slots[slot]] == state) {
+          return this->slots[slot];
+        }
+        slot = (slot + 1) & slot_mask;
+      }
+
+      const state_id id = this->states.size();
+      this->states.push_back(state);
+      this->slots[slot] = id;
+      if (this->states.size() * 2 > this->slots.size()) {
+        this->Grow();
+      }
+      return id;
+    }
+
+  private:
+    BurrowStateIndex(const BurrowStateIndex& other);
+    BurrowStateIndex& operator=(const BurrowStateIndex& other);
+};
+
+// MoveRecord remembers, for each state id, the state its cheapest known path came from and the move that made it, so the path can be walked back
+// Parent is a state_id, or a StateRef for parallel HDA*, whose parents can be in other partitions
+// A search only keeps one when asked for the moves, so the energy alone costs nothing for it
+template <typename Parent>
+class MoveRecord {
+  public:
+    vector<Parent> came_from;
+    vector<move_code> came_by;
+
+    void Record(const state_id id, const Parent& parent, const move_code move) {
+      if (id == this->came_from.size()) {
+        this->came_from.push_back(parent);
+        this->came_by.push_back(move);
+      }
+      else {
+        this->came_from[id] = parent;
+        this->came_by[id] = move;
+      }
+    }
+};
+
+// AStarLeastEnergy returns the least energy needed to organize the given burrow
+// returns a negative number if we fail to find a way to organize the burrow
+// Each state is stored once, in the index; the open set is a heap of state ids, whose keys are lowered in place when a cheaper path is found
+// If moves is not NULL, it is set to the moves of a least-energy path, which takes a parent and a move per state to work out
+template <typename State>
+int AStarLeastEnergy(const State& start, vector<BurrowMove>* moves) {
+  AOC_TIME_SCOPE("day23.astar");
+  const State organized = State::Organized();
+
+  // Follow A* algorithm, treating burrow states as nodes; developed referencing https://en.wikipedia.org/wiki/A*_search_algorithm#Pseudocode
+  BurrowStateIndex<State> index;
+  vector<int> lowest_energy_needed; // value of the lowest energy path from start to each state found
+  vector<int> energy_needed_heuristic; // worked out once per state, when it is found
+  MoveRecord<state_id> record;
+  IndexedHeap<int, state_id> open_set(0);
+
+  const state_id start_id = index.FindOrAdd(start);
+  lowest_energy_needed.push_back(0);
+  energy_needed_heuristic.push_back(start.EnergyNeededHeuristic());
+  if (moves != NULL) {
+    record.Record(start_id, kNoState, 0);
+  }
+  open_set.Grow(index.Size());
+  open_set.PushOrDecrease(start_id, energy_needed_heuristic[start_id]);
+
+  vector<typename State::Transition> transitions; // reused for every state, so expanding one does not allocate
+  while (!open_set.Empty()) {
+    AOC_HISTOGRAM("day23.astar.queue_size", open_set.Size());
+    const state_id current = open_set.Pop();
+
+    // Check if we've reached the goal burrow state
+    if (index.Get(current).IsOrganized(organized)) {
+      if (moves != NULL) {
+        moves->clear();
+        for (state_id id = current; record.came_from[id] != kNoState; id = record.came_from[id]) {
+          moves->push_back(index.Get(id).DescribeMove(record.came_by[id]));
+        }
+        reverse(moves->begin(), moves->end());
+      }
+      return lowest_energy_needed[current];
+    }
+
+    // Consider each move that the amphipods in the burrow could make to an adjacent state
+    index.Get(current).GetValidAdjacentStates(transitions);
+    AOC_COUNT("day23.astar.expansions", 1);
+    AOC_HISTOGRAM("day23.astar.transitions", transitions.size());
+    for (auto t:transitions) {
+      const int tentative_energy_needed = lowest_energy_needed[current] + t.energy;
+
+      const state_id adjacent = index.FindOrAdd(t.state);
+      if (adjacent == lowest_energy_needed.size()) {
+        lowest_energy_needed.push_back(tentative_energy_needed);
+        energy_needed_heuristic.push_back(t.state.EnergyNeededHeuristic());
+        open_set.Grow(index.Size());
+      }
+      else if (tentative_energy_needed < lowest_energy_needed[adjacent]) {
+        lowest_energy_needed[adjacent] = tentative_energy_needed;
+      }
+      else {
+        continue;
+      }
+
+      // This move is the shortest-known path from the start through current
+      if (moves != NULL) {
+        record.Record(adjacent, current, t.move);
+      }
+      open_set.PushOrDecrease(adjacent, tentative_energy_needed + energy_needed_heuristic[adjacent]);
+      AOC_COUNT("day23.astar.pushes", 1);
+    }
+  }
+
+  return -1;
+}
+
+// kHdaStarBatch is how many states each partition of parallel HDA* expands in a round, before the states found are sent to their owners
+const int kHdaStarBatch = 256;
+
+// StateRef names a state in parallel HDA* by the partition that owns it and its id there
+class StateRef {
+  public:
+    unsigned int partition;
+    state_id id;
+
+    StateRef(): partition(0), id(kNoState) {}
+    StateRef(const unsigned int p, const state_id i): partition(p), id(i) {}
+};
+
+// StateMessage is a state found by a partition of parallel HDA*, on its way to the partition that owns it, with the energy of the path that found it,
+// and the state and move it was found from
+template <typename State>
+class StateMessage {
+  public:
+    State state;
+    int energy_needed;
+    StateRef came_from;
+    move_code came_by;
+
+    StateMessage(const State& s, const int e, const StateRef& f, const move_code m): state(s), energy_needed(e), came_from(f), came_by(m) {}
+};
+
+// SearchPartition is the part of a parallel HDA* search that one partition owns: the states hashed to it, and its open set of them
+template <typename State>
+class SearchPartition {
+  public:
+    BurrowStateIndex<State> index;
+    vector<int> lowest_energy_needed; // indexed by id, as in AStarLeastEnergy
+    vector<int> energy_needed_heuristic;
+    MoveRecord<StateRef> record;
+    IndexedHeap<int, state_id> open_set;
+    vector<typename State::Transition> transitions;
+
+    SearchPartition(): open_set(0) {}
+
+  private:
+    SearchPartition(const SearchPartition& other);
+    SearchPartition& operator=(const SearchPartition& other);
+};
+
+// HdaStarLeastEnergy returns the least energy needed to organize the given burrow, searching with hash-distributed A* on the pool's threads
+// returns a negative number if we fail to find a way to organize the burrow
+// There is a partition per thread, and a state belongs to the partition its fingerprint picks; the search runs in rounds, and in each round every partition
+// first takes in the states sent to it in the last round, keeping the lowest energy for each, then expands up to kHdaStarBatch of its best states,
+// sending each state found to its owner for the next round; the mail for each round is kept apart from the last, so no partition waits on another's lock
+// An organized state popped by any partition sets the least energy found so far, and the partitions stop expanding states that cannot beat it
+// That energy is proved least once no partition has an open state that could beat it and no states are in the mail: with an admissible heuristic,
+// a cheapest path always has a state in an open set or in the mail whose guess is at most the least energy, so none left means nothing cheaper exists
+// Unlike AStarLeastEnergy, a state may be expanded again, if a cheaper path to it arrives after it was expanded
+// If moves is not NULL, it is set to the moves of a least-energy path, as in AStarLeastEnergy; the parents recorded can be in any partition
+template <typename State>
+int HdaStarLeastEnergy(const State& start, ThreadPool& pool, vector<BurrowMove>* moves) {
+  AOC_TIME_SCOPE("day23.hda_star");
+  const State organized = State::Organized();
+  const unsigned int partition_count = pool.ThreadCount();
+  auto owner = [partition_count](const State& state) { return (unsigned int)(state.Fingerprint() % partition_count); };
+
+  vector<SearchPartition<State>> partitions(partition_count);
+  vector<vector<StateMessage<State>>> mail[2]; // for even and odd rounds; entry from * partition_count + to is what one partition sent another
+  mail[0].resize(partition_count * partition_count);
+  mail[1].resize(partition_count * partition_count);
+  mail[0][owner(start)].push_back(StateMessage<State>(start, 0, StateRef(), 0));
+  atomic<int> least_energy_found(numeric_limits<int>::max());
+  mutex organized_lock; // guards organized_found, which is only set along with a lower least_energy_found
+  StateRef organized_found;
+
+  auto run_partition = [&](const unsigned int p, const int round) {
+    SearchPartition<State>& mine = partitions[p];
+    vector<vector<StateMessage<State>>>& inbox = mail[round % 2];
+    vector<vector<StateMessage<State>>>& outbox = mail[(round + 1) % 2];
+
+    // Take in the states sent here, keeping the lowest energy found for each
+    for (unsigned int from = 0; from < partition_count; ++from) {
+      for (auto m:inbox[from * partition_count + p]) {
+        const state_id id = mine.index.FindOrAdd(m.state);
+        if (id == mine.lowest_energy_needed.size()) {
+          mine.lowest_energy_needed.push_back(m.energy_needed);
+          mine.energy_needed_heuristic.push_back(m.state.EnergyNeededHeuristic());
+          mine.open_set.Grow(mine.index.Size());
+        }
+        else if (m.energy_needed < mine.lowest_energy_needed[id]) {
+          mine.lowest_energy_needed[id] = m.energy_needed;
+        }
+        else {
+          continue;
+        }
+        if (moves != NULL) {
+          mine.record.Record(id, m.came_from, m.came_by);
+        }
+        mine.open_set.PushOrDecrease(id, m.energy_needed + mine.energy_needed_heuristic[id]);
+      }
+      inbox[from * partition_count + p].clear();
+    }
+
+    // Expand the best states, unless they cannot lead to less energy than has already been found
+    for (int expanded = 0; expanded < kHdaStarBatch && !mine.open_set.Empty(); ++expanded) {
+      if (mine.open_set.TopKey() >= least_energy_found.load(memory_order_relaxed)) {
+        break;
+      }
+
+      const state_id current = mine.open_set.Pop();
+      const int current_energy_needed = mine.lowest_energy_needed[current];
+      if (mine.index.Get(current).IsOrganized(organized)) {
+        lock_guard<mutex> guard(organized_lock);
+        if (current_energy_needed < least_energy_found.load()) {
+          least_energy_found.store(current_energy_needed);
+          organized_found = StateRef(p, current);
+        }
+        continue;
+      }
+
+      mine.index.Get(current).GetValidAdjacentStates(mine.transitions);
+      AOC_COUNT("day23.hda_star.expansions", 1);
+      for (auto t:mine.transitions) {
+        outbox[p * partition_count + owner(t.state)].push_back(StateMessage<State>(t.state, current_energy_needed + t.energy, StateRef(p, current), t.move));
+      }
+    }
+  };
+
+  for (int round = 0; ; ++round) {
+    AOC_COUNT("day23.hda_star.rounds", 1);
+    for (unsigned int p = 0; p < partition_count; ++p) {
+      pool.Submit([&run_partition, p, round]() { run_partition(p, round); });
+    }
+    pool.Wait();
+
+    // Stop once nothing open or in the mail could still lead to less energy than has been found
+    const int least_energy = least_energy_found.load();
+    bool done = true;
+    for (auto& mailbox:mail[(round + 1) % 2]) {
+      done = done && mailbox.empty();
+    }
+    for (auto& partition:partitions) {
+      done = done && (partition.open_set.Empty() || partition.open_set.TopKey() >= least_energy);
+    }
+    if (!done) {
+      continue;
+    }
+
+    if (least_energy == numeric_limits<int>::max()) {
+      return -1;
+    }
+    if (moves != NULL) {
+      moves->clear();
+      for (StateRef ref = organized_found; ref.id != kNoState; ref = partitions[ref.partition].record.came_from[ref.id]) {
+        const SearchPartition<State>& holder = partitions[ref.partition];
+        if (holder.record.came_from[ref.id].id != kNoState) {
+          moves->push_back(holder.index.Get(ref.id).DescribeMove(holder.record.came_by[ref.id]));
+        }
+      }
+      reverse(moves->begin(), moves->end());
+    }
+    return least_energy;
+  }
+}
+
+// SearchShape searches a burrow of the given shape with the strategy; the hallway is as long as the puzzle's: two cells past the rooms at each end
+template <int Rooms, int Depth>
+int SearchShape(const BurrowDiagram& burrow, const SearchStrategy strategy, const unsigned int threads, vector<BurrowMove>* moves) {
+  const BurrowState<Rooms, Depth, 2 * Rooms + 3> start(burrow);
+  if (strategy == SearchStrategy::parallel_hda_star) {
+    ThreadPool pool(threads);
+    return HdaStarLeastEnergy(start, pool, moves);
+  }
+  return AStarLeastEnergy(start, moves);
+}
+
+// CompiledShape is a shape of burrow that has a search compiled for it
+class CompiledShape {
+  public:
+    int rooms;
+    int depth;
+    int (*search)(const BurrowDiagram& burrow, const SearchStrategy strategy, const unsigned int threads, vector<BurrowMove>* moves);
+};
+
+// kCompiledShapes are the puzzle's shapes (4 rooms, 2 or 4 deep), and larger ones with more types or deeper rooms
+const CompiledShape kCompiledShapes[] = {
+  {4, 2, SearchShape<4, 2>},
+  {4, 4, SearchShape<4, 4>},
+  {4, 8, SearchShape<4, 8>},
+  {6, 2, SearchShape<6, 2>},
+  {6, 4, SearchShape<6, 4>},
+  {6, 8, SearchShape<6, 8>},
+};
+
+// FindCompiledShape returns the compiled shape the burrow can be searched as, or throws invalid_argument if there is none
+const CompiledShape& FindCompiledShape(const BurrowDiagram& burrow) {
+  for (const CompiledShape& shape:kCompiledShapes) {
+    if (shape.rooms == burrow.RoomCount() && shape.depth == burrow.RoomDepth() && burrow.hallway_length == 2 * shape.rooms + 3) {
+      return shape;
+    }
+  }
+  throw invalid_argument("no search is compiled for a burrow of " + to_string(burrow.RoomCount()) + " rooms " + to_string(burrow.RoomDepth()) +
+    " deep under a hallway " + to_string(burrow.hallway_length) + " long");
+}
+
+int LeastEnergyToOrganize(const vector<string>& diagram, const SearchStrategy strategy, const unsigned int threads, vector<BurrowMove>* moves) {
+  const BurrowDiagram burrow = ParseBurrow(diagram);
+  return FindCompiledShape(burrow).search(burrow, strategy, threads, moves);
+}
+
+// UnfoldDiagram returns the full diagram for Part 2: "between the first and second lines of text that contain amphipod starting positions, insert the following lines"
+vector<string> UnfoldDiagram(const vector<string>& diagram) {
+  vector<string> full_diagram = diagram;
+  full_diagram.insert(full_diagram.begin() + 3, "  #D#B#A#C#");
+  full_diagram.insert(full_diagram.begin() + 3, "  #D#C#B#A#");
+  return full_diagram;
+}
+
+void Day23Solver::Parse(const vector<LineView>& lines) {
+  for (auto line:lines) {
+    this->diagram.push_back(line.ToString());
+  }
+
+  // Check that the diagram describes a burrow that can be searched; Part 2's lines only fit a burrow of the puzzle's four rooms, so it checks its own
+  FindCompiledShape(ParseBurrow(this->diagram));
+}
+
+int Day23Solver::SolvePart1() {
+  return LeastEnergyToOrganize(this->diagram, this->strategy, this->threads, this->record_moves ? &this->moves[0] : NULL);
+}
+
+int Day23Solver::SolvePart2() {
+  if (ParseBurrow(this->diagram).RoomCount() != 4) {
+    throw logic_error("only a burrow of four rooms can be unfolded");
+  }
+  return LeastEnergyToOrganize(UnfoldDiagram(this->diagram), this->strategy, this->threads, this->record_moves ? &this->moves[1] : NULL);
+}
+
+} // namespace day23
@@ -0,0 +1,63 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 23 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: What is the least energy required to organize the amphipods?
+// Part 2: Using the initial configuration from the full diagram, what is the least energy required to organize the amphipods?
+
+#ifndef DAY23_SOLVER_HPP_
+#define DAY23_SOLVER_HPP_
+
+#include "../util/solver.hpp" // Solver
+#include <string>
+#include <vector>
+
+namespace day23 {
+
+// SearchStrategy selects how the least energy is searched for
+//   astar is a single-threaded A* over a hash index of the burrow states it finds, with a heap of their ids
+//   parallel_hda_star is hash-distributed A*: each state is owned by one partition, picked by its hash, which keeps its own index and open set;
+//   the partitions expand their best states in parallel, and send the states they find to their owners between rounds
+enum class SearchStrategy { astar=0, parallel_hda_star=1 };
+
+// BurrowMove is one move of an amphipod on a least-energy path: its type, the cells it moves from and to (e.g. "room B", "hallway 3"),
+// and the energy the move takes
+class BurrowMove {
+  public:
+    char amphipod;
+    std::string from;
+    std::string to;
+    int energy;
+};
+
+// LeastEnergyToOrganize returns the least energy needed to organize the amphipods in the burrow in the diagram, or a negative number if they cannot be
+// threads is the number of threads parallel_hda_star uses; 0 uses one per hardware thread, and astar uses one
+// If moves is not NULL, it is set to the moves of a least-energy path; the search only keeps each state's parent when they are asked for
+// Throws std::invalid_argument if the diagram is not a burrow that can be searched
+int LeastEnergyToOrganize(const std::vector<std::string>& diagram, const SearchStrategy strategy, const unsigned int threads=0,
+  std::vector<BurrowMove>* moves=NULL);
+
+// UnfoldDiagram returns the full diagram for Part 2, with two more lines of amphipods in the rooms
+std::vector<std::string> UnfoldDiagram(const std::vector<std::string>& diagram);
+
+class Day23Solver : public Solver<int, int> {
+  private:
+    std::vector<std::string> diagram; // as folded up in the input
+    SearchStrategy strategy;
+    unsigned int threads;
+    bool record_moves;
+    std::vector<BurrowMove> moves[2]; // of each part, if recorded
+
+  public:
+    explicit Day23Solver(const SearchStrategy s=SearchStrategy::astar, const unsigned int t=0, const bool r=false): strategy(s), threads(t), record_moves(r) {}
+
+    // Moves returns the moves of a least-energy path found for the part (1 or 2), if the solver was made to record them and has solved it
+    const std::vector<BurrowMove>& Moves(const int part) const { return this->moves[part-1]; }
+
+    void Parse(const std::vector<LineView>& lines);
+    int SolvePart1();
+    int SolvePart2();
+};
+
+} // namespace day23
+
+#endif // DAY23_SOLVER_HPP_
@@ -0,0 +1,1275 @@
+// solver.cpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 24 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: What is the largest model number accepted by MONAD?
+// Part 2: What is the smallest model number accepted by MONAD?
+
+#include "solver.hpp"
+#include "../util/instrument.hpp" // AOC_TIME_SCOPE, AOC_COUNT, AOC_HISTOGRAM
+#include "../util/threadpool.hpp" // ThreadPool
+#include <iostream>
+#include <tuple>
+#include <vector>
+#include <string>
+#include <regex>
+#include <stdexcept>
+#include <unordered_set>
+#include <unordered_map>
+#include <map>
+#include <algorithm>
+#include <limits>
+#include <cstdlib>
+#include <cstddef>
+#include <mutex>
+#ifdef __x86_64__
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace day24 {
+
+// Define types/enums to make it easier to determine which variable(s) are being manipulated
+enum class ALUVariable : int { w=0, x=1, y=2, z=3, VARIABLE_COUNT=4 };
+
+// returns VARIABLE_COUNT if char does not match a variable
+ALUVariable FromInstructionChar(const char& c) {
+  switch(c) {
+    case 'w': return ALUVariable::w;
+    case 'x': return ALUVariable::x;
+    case 'y': return ALUVariable::y;
+    case 'z': return ALUVariable::z;
+
+    default: return ALUVariable::VARIABLE_COUNT;
+  }
+}
+
+// dedicated Instruction class for parsing arguments/variables/literals/command from instruction line
+class Instruction {
+  private:
+    ALUVariable arg2;
+    bool arg2_literal_defined;
+    long long int arg2_literal;
+
+  public:
+    string command;
+    ALUVariable arg1;
+
+    Instruction(const string& line) {
+      smatch m;
+      static const regex kInstructionFormat("^([a-z]{3}) ([a-z])( ([a-z0-9-]+)){0,1}"); // built once, since it is costly to build
+      regex_search(line, m, kInstructionFormat);
+      if (m.size() != 5) {
+        throw invalid_argument("unexpected line format");
+      }
+
+      // parse command from instruction
+      this->command = m[1];
+
+      // parse first argument to the instruction
+      this->arg1 = FromInstructionChar(m.str(2)[0]);
+
+      // parse second argument to the instruction
+      this->arg2 = ALUVariable::VARIABLE_COUNT;
+      this->arg2_literal_defined = false;
+
+      if (m[4] != "") {
+        this->arg2 = FromInstructionChar(m.str(4)[0]);
+        if (this->arg2 == ALUVariable::VARIABLE_COUNT) {
+          this->arg2_literal_defined = true;
+          this->arg2_literal = stoi(m[4]);
+        }
+      }
+    }
+
+    // Assignment operator
+    Instruction& operator=(const Instruction& other) {
+      if (this != &other) {
+        this->command = other.command;
+        this->arg1 = other.arg1;
+        this->arg2 = other.arg2;
+        this->arg2_literal_defined = other.arg2_literal_defined;
+        this->arg2_literal = other.arg2_literal;
+      }
+
+      return *this;
+    }
+
+    // returns VARIABLE_COUNT if there is no 2nd argument variable (may still be 2nd argument literal)
+    ALUVariable GetSecondArgumentVariable() const {
+      return this->arg2;
+    }
+
+    // returns 2nd value of pair as false if there is no 2nd argument literal in the command (may still be 2nd argument variable)
+    pair<long long int,bool> GetSecondArgumentLiteral() const {
+      return pair<long long int,bool>(this->arg2_literal, this->arg2_literal_defined);
+    }
+};
+
+// GetNextInstructionLine returns the next instruction line after curr, skipping any lines that start with "#"
+int GetNextInstructionLine(const vector<string>& lines, const int curr) {
+  int next = curr + 1;
+  while (next < lines.size() && lines[next][0] == '#') {
+    ++next;
+  }
+
+  return next;
+}
+
+constexpr long long int possible_input_digits[9] = {1,2,3,4,5,6,7,8,9};
+const long long int max_digit = possible_input_digits[8];
+const int kMaxModelNumberDigits = 18; // the most that fit in a long long int
+
+// AluOperation is the operation of an instruction lifted out of the MONAD program's text
+// set (a = b) and neq (a = a != b ? 1 : 0) are not in the ALU's instruction set, but come out of compiling a program (see CompileAlu)
+enum class AluOperation { inp=0, add=1, mul=2, div=3, mod=4, eql=5, set=6, neq=7 };
+
+// Evaluate returns the result of an operation other than inp on a and b
+// div rounds toward zero, as the ALU's does; division or modulo by 0 makes the program invalid
+inline long long int Evaluate(const AluOperation operation, const long long int a, const long long int b) {
+  switch (operation) {
+    case AluOperation::add: return a + b;
+    case AluOperation::mul: return a * b;
+    case AluOperation::div:
+      if (b == 0) {
+        throw invalid_argument("cannot divide by 0");
+      }
+      return a / b;
+    case AluOperation::mod:
+      if (b == 0) {
+        throw invalid_argument("cannot take modulo 0");
+      }
+      return a % b;
+    case AluOperation::eql: return a == b ? 1 : 0;
+    case AluOperation::set: return b;
+    case AluOperation::neq: return a != b ? 1 : 0;
+    default: throw logic_error("inp has no result to evaluate");
+  }
+}
+
+// AluInstruction is one instruction of the program, with its operation and operands resolved, so it can be run without parsing it again
+class AluInstruction {
+  public:
+    AluOperation operation;
+    int a; // the variable written, as an ALUVariable
+    int b; // the variable read as the second operand, or VARIABLE_COUNT if it is the literal
+    long long int literal;
+
+    // Parse lifts one line of the program, or throws invalid_argument if it is not an ALU instruction
+    static AluInstruction Parse(const string& line) {
+      const Instruction parsed(line);
+      AluInstruction lifted;
+      if (parsed.command == "inp") {
+        lifted.operation = AluOperation::inp;
+      }
+      else if (parsed.command == "add") {
+        lifted.operation = AluOperation::add;
+      }
+      else if (parsed.command == "mul") {
+        lifted.operation = AluOperation::mul;
+      }
+      else if (parsed.command == "div") {
+        lifted.operation = AluOperation::div;
+      }
+      else if (parsed.command == "mod") {
+        lifted.operation = AluOperation::mod;
+      }
+      else if (parsed.command == "eql") {
+        lifted.operation = AluOperation::eql;
+      }
+      else {
+        throw invalid_argument("unexpected instruction: " + parsed.command);
+      }
+
+      lifted.a = static_cast<int>(parsed.arg1);
+      lifted.b = static_cast<int>(parsed.GetSecondArgumentVariable());
+      lifted.literal = parsed.GetSecondArgumentLiteral().second ? parsed.GetSecondArgumentLiteral().first : 0;
+      const bool has_second_argument = lifted.b != static_cast<int>(ALUVariable::VARIABLE_COUNT) || parsed.GetSecondArgumentLiteral().second;
+      if (parsed.arg1 == ALUVariable::VARIABLE_COUNT || has_second_argument == (lifted.operation == AluOperation::inp)) {
+        throw invalid_argument("unexpected operands: " + line);
+      }
+      return lifted;
+    }
+
+    // Reads returns whether the instruction's result depends on the variable's value before it
+    // inp overwrites its variable, and so does multiplying by a literal 0
+    bool Reads(const int variable) const {
+      if (this->operation == AluOperation::inp) {
+        return false;
+      }
+      if (this->b == variable) {
+        return true;
+      }
+      return this->a == variable && !(this->operation == AluOperation::mul && this->b == static_cast<int>(ALUVariable::VARIABLE_COUNT) && this->literal == 0);
+    }
+
+    // Set returns an instruction that sets the variable to the literal
+    static AluInstruction Set(const int variable, const long long int value) {
+      AluInstruction set;
+      set.operation = AluOperation::set;
+      set.a = variable;
+      set.b = static_cast<int>(ALUVariable::VARIABLE_COUNT);
+      set.literal = value;
+      return set;
+    }
+};
+
+// ParseProgram returns the instructions of the program, skipping lines that start with "#"
+vector<AluInstruction> ParseProgram(const vector<string>& lines) {
+  vector<AluInstruction> program;
+  for (int l = GetNextInstructionLine(lines, -1); l < lines.size(); l = GetNextInstructionLine(lines, l)) {
+    program.push_back(AluInstruction::Parse(lines[l]));
+  }
+  return program;
+}
+
+// CompileAlu returns the instructions with their constant operands folded in, given which variables hold known values before them
+// Where a variable's value is known, reading it reads that value as a literal, and an operation on it and a literal is worked out here, becoming a set;
+// add 0, mul 1 and div 1 are dropped, mul 0 becomes a set, a set replaces a set of the same variable just before it, and "eql a b" then "eql a 0" is "neq a b"
+// After each compiled instruction, every variable holds what it would have after the instructions it came from, so states can still be compared
+vector<AluInstruction> CompileAlu(const vector<AluInstruction>& instructions, const bool known_at_start[], const long long int values_at_start[]) {
+  const int kLiteral = static_cast<int>(ALUVariable::VARIABLE_COUNT);
+  bool known[kLiteral];
+  long long int value[kLiteral];
+  for (int v = 0; v < kLiteral; ++v) {
+    known[v] = known_at_start[v];
+    value[v] = values_at_start[v];
+  }
+
+  vector<AluInstruction> compiled;
+  auto emit = [&compiled, kLiteral](const AluInstruction& i) {
+    AluInstruction* last = compiled.empty() ? NULL : &compiled.back();
+    if (last != NULL && i.operation == AluOperation::set && last->operation == AluOperation::set && last->a == i.a) {
+      *last = i;
+    }
+    else if (last != NULL && i.operation == AluOperation::eql && i.b == kLiteral && i.literal == 0 && last->operation == AluOperation::eql && last->a == i.a) {
+      last->operation = AluOperation::neq;
+    }
+    else {
+      compiled.push_back(i);
+    }
+  };
+
+  for (auto i:instructions) {
+    if (i.operation == AluOperation::inp) {
+      emit(i);
+      known[i.a] = false;
+      continue;
+    }
+
+    if (i.b != kLiteral && known[i.b]) {
+      i.literal = value[i.b];
+      i.b = kLiteral;
+    }
+    const bool literal = i.b == kLiteral;
+
+    if (known[i.a] && literal) {
+      const long long int result = Evaluate(i.operation, value[i.a], i.literal);
+      if (result != value[i.a]) {
+        emit(AluInstruction::Set(i.a, result));
+      }
+      value[i.a] = result;
+      continue;
+    }
+
+    if (known[i.a]) {
+      // The operand varies; adding it to 0 or multiplying 1 by it is just a set, and multiplying 0 by it changes nothing
+      if (i.operation == AluOperation::mul && value[i.a] == 0) {
+        continue;
+      }
+      if ((i.operation == AluOperation::add && value[i.a] == 0) || (i.operation == AluOperation::mul && value[i.a] == 1)) {
+        i.operation = AluOperation::set;
+      }
+    }
+    else if (literal) {
+      if ((i.operation == AluOperation::add && i.literal == 0) || ((i.operation == AluOperation::mul || i.operation == AluOperation::div) && i.literal == 1)) {
+        continue;
+      }
+      if (i.operation == AluOperation::mul && i.literal == 0) {
+        emit(AluInstruction::Set(i.a, 0));
+        known[i.a] = true;
+        value[i.a] = 0;
+        continue;
+      }
+    }
+    emit(i);
+    known[i.a] = false;
+  }
+  return compiled;
+}
+
+// CompileProgram returns the whole parsed program compiled, starting with every variable at 0, as the ALU does
+vector<AluInstruction> CompileProgram(const vector<AluInstruction>& program) {
+  const bool known[] = {true, true, true, true};
+  const long long int values[] = {0, 0, 0, 0};
+  return CompileAlu(program, known, values);
+}
+
+// dedicated class to track variable values of an ALU
+class ALUState {
+  private:
+    vector<long long int> variables;
+
+    void copy(const ALUState& other) {
+      this->variables.resize(other.variables.size());
+      for (int i = 0; i < other.variables.size(); ++i) {
+        this->variables[i] = other.variables[i];
+      }
+    }
+
+  public:
+    // ALU state starts with all variables at value 0
+    ALUState() {
+      for (int i = 0; i < static_cast<int>(ALUVariable::VARIABLE_COUNT); ++i) {
+        this->variables.push_back(0);
+      }
+    }
+
+    // copy constructor
+    ALUState(const ALUState& other) {
+      this->copy(other);
+    }
+
+    // assignment operator
+    ALUState& operator=(const ALUState& other) {
+      if (this != &other) {
+        this->copy(other);
+      }
+      return *this;
+    }
+
+    // operator< is ecessary to implement for class to be used as map key
+    bool operator<(const ALUState& other) const {
+      // unexpected corner case; we always expect ALU states to have the same number of variables at all times
+      if (this->variables.size() != other.variables.size()) {
+        return this->variables.size() < other.variables.size();
+      }
+
+      for (int i = 0; i < this->variables.size(); ++i) {
+        if (this->variables[i] < other.variables[i]) {
+          return true;
+        }
+        else if (this->variables[i] > other.variables[i]) {
+          return false;
+        }
+        // if they are equal, continue
+      }
+
+      return false;
+    }
+
+    // Returns the value of this ALU state's specified variable
+    long long int GetVariableValue(const ALUVariable var) const {
+      if (var >= ALUVariable::VARIABLE_COUNT) {
+        throw range_error("ALU variable index");
+      }
+      else if (static_cast<int>(var) >= this->variables.size()) {
+        throw logic_error("ALU state has unexpected number of variables");
+      }
+
+      return this->variables[static_cast<int>(var)];
+    }
+
+    // Variable returns the value of the variable, given as an ALUVariable's int, for compiled instructions to change in place; it must be in range
+    long long int& Variable(const int var) { return this->variables[var]; }
+
+    ~ALUState() {}
+};
+
+// defining the << operator function to ease printing
+ostream& operator<<(ostream& os, const ALUState& c) {
+  for (int i = 0; i < static_cast<int>(ALUVariable::VARIABLE_COUNT); ++i) {
+    os << c.GetVariableValue(static_cast<ALUVariable>(i));
+    if (i < static_cast<int>(ALUVariable::VARIABLE_COUNT) - 1) {
+      os << ",";
+    }
+  }
+  return os;
+}
+
+// The inputs that get to a state are kept as the model number they start, packed into one integer: its digits so far, as a number
+// ex. inputs 1, 2, 3 are kept as 123, and no inputs as 0
+// Every state in a frontier has had the same number of inputs, and no digit is 0, so comparing the packed numbers compares the model numbers they start
+typedef long long int model_number_prefix;
+
+// AppendInput returns the prefix with the digit input after it
+inline model_number_prefix AppendInput(const model_number_prefix prefix, const long long int digit) { return prefix * 10 + digit; }
+
+// Values determined by studying input.txt
+const long long int z_multiplier = 26;
+
+// IsZDivider returns whether the instruction is one of those that bring z down a level, "div z 26"
+bool IsZDivider(const AluInstruction& i) {
+  return i.operation == AluOperation::div && i.a == static_cast<int>(ALUVariable::z) && i.b == static_cast<int>(ALUVariable::VARIABLE_COUNT) && i.literal == z_multiplier;
+}
+const long long int max_addition = 15;
+
+// If a state's z value gets bigger than can be divided down to zero, we know it will not be valid
+// by studying input.txt, we notice that z is always of the form  26*(26*...26*(digitX + literal-from-file) + digitZ + literal-from-file)... ) ... + digitY + literal-from-file
+// where MAX(literal-from-file) is 15
+long long int ComputeMaximumMultipliedZValue(const long long int z_dividers_remaining) {
+  if (z_dividers_remaining == 0) {
+    return 0;
+  }
+  else if (z_dividers_remaining == 1) {
+    return max_digit + max_addition;
+  }
+  else {
+    return z_multiplier * ComputeMaximumMultipliedZValue(z_dividers_remaining-1) + max_digit + max_addition;
+  }
+}
+
+// Since the only difference between Part 1 and Part 2 is max vs min, make comparators to use in each case
+typedef bool (*comparison)(const long long int& a, const long long int& b);
+bool AGreaterThanB(const long long int& a, const long long int& b) { return a > b; }
+bool ALessThanB(const long long int& a, const long long int& b) { return a < b; }
+
+// KeepPreferredInputs stores the inputs that reach the state, unless the frontier already has inputs for it that are preferred, based on the comparison function
+void KeepPreferredInputs(map<ALUState, model_number_prefix>& frontier, const ALUState& state, const model_number_prefix inputs, comparison compare_func) {
+  auto found = frontier.find(state);
+  if (found == frontier.end()) {
+    frontier.emplace(state, inputs);
+  }
+  else if ((*compare_func)(inputs, found->second)) {
+    found->second = inputs;
+  }
+}
+
+// StepFrontier runs one compiled instruction other than inp on every state of the frontier, keeping the states that could still be valid
+// The operation and the kind of operand are template parameters, so the loop over the states is compiled for just that instruction
+template <AluOperation Operation, bool LiteralOperand>
+void StepFrontier(const map<ALUState, model_number_prefix>& frontier, const AluInstruction& i, const long long int max_possibly_valid_z_value,
+  comparison compare_func, map<ALUState, model_number_prefix>& next_frontier) {
+  for (auto& entry:frontier) {
+    ALUState state(entry.first);
+    const long long int b = LiteralOperand ? i.literal : state.Variable(i.b);
+    state.Variable(i.a) = Evaluate(Operation, state.Variable(i.a), b);
+    if (state.GetVariableValue(ALUVariable::z) <= max_possibly_valid_z_value) {
+      KeepPreferredInputs(next_frontier, state, entry.second, compare_func);
+    }
+  }
+}
+
+// StepFrontierWithOperand picks the StepFrontier compiled for the kind of operand the instruction has
+template <AluOperation Operation>
+void StepFrontierWithOperand(const map<ALUState, model_number_prefix>& frontier, const AluInstruction& i, const long long int max_possibly_valid_z_value,
+  comparison compare_func, map<ALUState, model_number_prefix>& next_frontier) {
+  if (i.b == static_cast<int>(ALUVariable::VARIABLE_COUNT)) {
+    StepFrontier<Operation, true>(frontier, i, max_possibly_valid_z_value, compare_func, next_frontier);
+  }
+  else {
+    StepFrontier<Operation, false>(frontier, i, max_possibly_valid_z_value, compare_func, next_frontier);
+  }
+}
+
+// ComputeValidModelNumber uses the given comparison function to return the most preferred model number that is valid, given the compiled MONAD program
+// Each instruction is run on every ALU state reachable so far, a whole frontier at a time
+long long int ComputeValidModelNumber(const vector<AluInstruction>& program, comparison compare_func, long long int z_dividers_remaining) {
+  AOC_TIME_SCOPE("day24.compute_model_number");
+  long long int max_possibly_valid_z_value = ComputeMaximumMultipliedZValue(z_dividers_remaining);
+  
+  // Create initial possible ALU state
+  ALUState initial = ALUState();
+  map<ALUState, model_number_prefix> best_possible_states; // value of this map is the preferred series of inputs to get to the state
+  best_possible_states[initial] = 0;
+  
+  // Process each instruction on all possible ALU states, given input possibilities
+  for (auto i:program) {
+    // update continuous z-divider instruction count as we go
+    if (IsZDivider(i)) {
+      --z_dividers_remaining;
+      max_possibly_valid_z_value = ComputeMaximumMultipliedZValue(z_dividers_remaining);
+    }
+
+    AOC_COUNT("day24.instructions_run", 1);
+    AOC_HISTOGRAM("day24.states_per_instruction", best_possible_states.size());
+
+    map<ALUState, model_number_prefix> next_best_possible_states;
+    switch (i.operation) {
+      case AluOperation::inp:
+        // Branch each state into one per digit that could be input
+        for (auto& entry:best_possible_states) {
+          for (auto digit:possible_input_digits) {
+            ALUState state(entry.first);
+            state.Variable(i.a) = digit;
+            KeepPreferredInputs(next_best_possible_states, state, AppendInput(entry.second, digit), compare_func);
+          }
+        }
+        break;
+      case AluOperation::add:
+        StepFrontierWithOperand<AluOperation::add>(best_possible_states, i, max_possibly_valid_z_value, compare_func, next_best_possible_states);
+        break;
+      case AluOperation::mul:
+        StepFrontierWithOperand<AluOperation::mul>(best_possible_states, i, max_possibly_valid_z_value, compare_func, next_best_possible_states);
+        break;
+      case AluOperation::div:
+        StepFrontierWithOperand<AluOperation::div>(best_possible_states, i, max_possibly_valid_z_value, compare_func, next_best_possible_states);
+        break;
+      case AluOperation::mod:
+        StepFrontierWithOperand<AluOperation::mod>(best_possible_states, i, max_possibly_valid_z_value, compare_func, next_best_possible_states);
+        break;
+      case AluOperation::eql:
+        StepFrontierWithOperand<AluOperation::eql>(best_possible_states, i, max_possibly_valid_z_value, compare_func, next_best_possible_states);
+        break;
+      case AluOperation::set:
+        StepFrontierWithOperand<AluOperation::set>(best_possible_states, i, max_possibly_valid_z_value, compare_func, next_best_possible_states);
+        break;
+      case AluOperation::neq:
+        StepFrontierWithOperand<AluOperation::neq>(best_possible_states, i, max_possibly_valid_z_value, compare_func, next_best_possible_states);
+        break;
+    }
+
+    // Move to next possible states for next instruction
+    best_possible_states.swap(next_best_possible_states);
+  }
+
+  // Determine which valid output has the preferred model number, according to given comparison function
+  long long int best_model_number = 0; // starting value is ok because 0 is not a valid model number (since no digit can be 0)
+  for (auto state:best_possible_states) {
+    if (state.first.GetVariableValue(ALUVariable::z) == 0) {
+      long long int valid_model_number = state.second;
+      if (best_model_number == 0 || (*compare_func)(valid_model_number, best_model_number)) {
+        best_model_number = valid_model_number;
+      }
+    }
+  }
+
+  return best_model_number;
+}
+
+// InputRange is the largest and smallest series of inputs that get to a state, so one search can find both parts' model numbers
+class InputRange {
+  public:
+    model_number_prefix largest;
+    model_number_prefix smallest;
+
+    InputRange(): largest(0), smallest(0) {}
+};
+
+inline InputRange AppendInput(const InputRange& inputs, const long long int digit) {
+  InputRange appended;
+  appended.largest = AppendInput(inputs.largest, digit);
+  appended.smallest = AppendInput(inputs.smallest, digit);
+  return appended;
+}
+
+// AluFrontier is a frontier of ALU states kept a variable at a time (a structure of arrays), so an instruction runs over every state in one batch
+// Entry s of each array, and of inputs, is state s; Inputs is what is kept of the inputs that get to each state
+template <typename Inputs>
+class AluFrontier {
+  public:
+    vector<long long int> variables[static_cast<int>(ALUVariable::VARIABLE_COUNT)];
+    vector<Inputs> inputs;
+
+    size_t Size() const { return this->inputs.size(); }
+};
+
+// BatchIsa is the instruction set a batch of the frontier is run with; the best the machine supports is picked at run time
+enum class BatchIsa { scalar=0, avx2=1, avx512=2 };
+
+// kExactDivisionLimit bounds the dividends that the vector division is exact for: the division is done in doubles and truncated, and below 2^52,
+// a quotient just short of an integer is still more than half a unit in the last place short of it, so it never rounds up to the integer
+const long long int kExactDivisionLimit = 1LL << 52;
+
+// ScalarBatch runs the operation on each a[s] with b[s], or the literal if b is NULL; it is what the vector kernels fall back on
+template <AluOperation Operation>
+void ScalarBatch(long long int* a, const long long int* b, const long long int literal, const size_t count) {
+  for (size_t s = 0; s < count; ++s) {
+    a[s] = Evaluate(Operation, a[s], b == NULL ? literal : b[s]);
+  }
+}
+
+#ifdef __x86_64__
+// Avx2Batch is ScalarBatch four states at a time
+// AVX2 has no 64-bit multiply, so it is built from 32-bit ones, and no conversion between 64-bit ints and doubles, so division is left to ScalarBatch
+template <AluOperation Operation>
+__attribute__((target("avx2")))
+void Avx2Batch(long long int* a, const long long int* b, const long long int literal, const size_t count) {
+  const __m256i literal_lanes = _mm256_set1_epi64x(literal);
+  const __m256i ones = _mm256_set1_epi64x(1);
+  size_t s = 0;
+  for (; s + 4 <= count; s += 4) {
+    const __m256i va = _mm256_loadu_si256((const __m256i*)(a + s));
+    const __m256i vb = b == NULL ? literal_lanes : _mm256_loadu_si256((const __m256i*)(b + s));
+    __m256i result;
+    switch (Operation) {
+      case AluOperation::add: result = _mm256_add_epi64(va, vb); break;
+      case AluOperation::mul: {
+        // the low 64 bits of the product are lo*lo, plus the two cross products shifted up
+        const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(va, 32), vb), _mm256_mul_epu32(va, _mm256_srli_epi64(vb, 32)));
+        result = _mm256_add_epi64(_mm256_mul_epu32(va, vb), _mm256_slli_epi64(cross, 32));
+        break;
+      }
+      case AluOperation::eql: result = _mm256_and_si256(_mm256_cmpeq_epi64(va, vb), ones); break;
+      case AluOperation::neq: result = _mm256_andnot_si256(_mm256_cmpeq_epi64(va, vb), ones); break;
+      case AluOperation::set: result = vb; break;
+      default: ScalarBatch<Operation>(a + s, b == NULL ? NULL : b + s, literal, 4); continue;
+    }
+    _mm256_storeu_si256((__m256i*)(a + s), result);
+  }
+  ScalarBatch<Operation>(a + s, b == NULL ? NULL : b + s, literal, count - s);
+}
+
+// Avx512Batch is ScalarBatch eight states at a time
+// Division is done in doubles, for eight states at once that are all within kExactDivisionLimit and have no divisor of 0; others fall back on ScalarBatch
+template <AluOperation Operation>
+__attribute__((target("avx512f,avx512dq")))
+void Avx512Batch(long long int* a, const long long int* b, const long long int literal, const size_t count) {
+  const __m512i literal_lanes = _mm512_set1_epi64(literal);
+  const __m512i ones = _mm512_set1_epi64(1);
+  const __m512i exact_limit = _mm512_set1_epi64(kExactDivisionLimit);
+  size_t s = 0;
+  for (; s + 8 <= count; s += 8) {
+    const __m512i va = _mm512_loadu_si512(a + s);
+    const __m512i vb = b == NULL ? literal_lanes : _mm512_loadu_si512(b + s);
+    __m512i result;
+    switch (Operation) {
+      case AluOperation::add: result = _mm512_add_epi64(va, vb); break;
+      case AluOperation::mul: result = _mm512_mullo_epi64(va, vb); break;
+      case AluOperation::eql: result = _mm512_maskz_mov_epi64(_mm512_cmpeq_epi64_mask(va, vb), ones); break;
+      case AluOperation::neq: result = _mm512_maskz_mov_epi64(_mm512_cmpneq_epi64_mask(va, vb), ones); break;
+      case AluOperation::set: result = vb; break;
+      case AluOperation::div:
+      case AluOperation::mod: {
+        // the abs of INT64_MIN is still INT64_MIN, so it is compared unsigned, as 2^63, to fall back too
+        if (_mm512_cmpeq_epi64_mask(vb, _mm512_setzero_si512()) != 0 || _mm512_cmpge_epu64_mask(_mm512_abs_epi64(va), exact_limit) != 0) {
+          ScalarBatch<Operation>(a + s, b == NULL ? NULL : b + s, literal, 8);
+          continue;
+        }
+        const __m512i quotient = _mm512_cvttpd_epi64(_mm512_div_pd(_mm512_cvtepi64_pd(va), _mm512_cvtepi64_pd(vb)));
+        result = Operation == AluOperation::div ? quotient : _mm512_sub_epi64(va, _mm512_mullo_epi64(quotient, vb));
+        break;
+      }
+      default: ScalarBatch<Operation>(a + s, b == NULL ? NULL : b + s, literal, 8); continue;
+    }
+    _mm512_storeu_si512(a + s, result);
+  }
+  ScalarBatch<Operation>(a + s, b == NULL ? NULL : b + s, literal, count - s);
+}
+#endif
+
+// DetectBatchIsa returns the best instruction set the machine supports for running batches
+BatchIsa DetectBatchIsa() {
+#ifdef __x86_64__
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq")) {
+    return BatchIsa::avx512;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    return BatchIsa::avx2;
+  }
+#endif
+  return BatchIsa::scalar;
+}
+
+// RunBatchWith runs the operation on the frontier with the given instruction set
+template <AluOperation Operation>
+void RunBatchWith(const BatchIsa isa, long long int* a, const long long int* b, const long long int literal, const size_t count) {
+#ifdef __x86_64__
+  if (isa == BatchIsa::avx512) {
+    Avx512Batch<Operation>(a, b, literal, count);
+    return;
+  }
+  if (isa == BatchIsa::avx2) {
+    Avx2Batch<Operation>(a, b, literal, count);
+    return;
+  }
+#endif
+  ScalarBatch<Operation>(a, b, literal, count);
+}
+
+// RunBatch runs one compiled instruction other than inp on every state of the frontier
+template <typename Inputs>
+void RunBatch(const AluInstruction& i, AluFrontier<Inputs>& frontier) {
+  static const BatchIsa isa = DetectBatchIsa();
+  long long int* a = frontier.variables[i.a].data();
+  const long long int* b = i.b == static_cast<int>(ALUVariable::VARIABLE_COUNT) ? NULL : frontier.variables[i.b].data();
+  const size_t count = frontier.Size();
+  switch (i.operation) {
+    case AluOperation::add: RunBatchWith<AluOperation::add>(isa, a, b, i.literal, count); break;
+    case AluOperation::mul: RunBatchWith<AluOperation::mul>(isa, a, b, i.literal, count); break;
+    case AluOperation::div: RunBatchWith<AluOperation::div>(isa, a, b, i.literal, count); break;
+    case AluOperation::mod: RunBatchWith<AluOperation::mod>(isa, a, b, i.literal, count); break;
+    case AluOperation::eql: RunBatchWith<AluOperation::eql>(isa, a, b, i.literal, count); break;
+    case AluOperation::set: RunBatchWith<AluOperation::set>(isa, a, b, i.literal, count); break;
+    case AluOperation::neq: RunBatchWith<AluOperation::neq>(isa, a, b, i.literal, count); break;
+    default: throw logic_error("inp cannot be run as a batch");
+  }
+}
+
+// BranchOnInput returns the frontier with each state branched into one per digit that could be input into the variable
+template <typename Inputs>
+AluFrontier<Inputs> BranchOnInput(const AluFrontier<Inputs>& frontier, const int variable) {
+  const size_t count = frontier.Size();
+  const size_t digit_count = sizeof(possible_input_digits) / sizeof(possible_input_digits[0]);
+  AluFrontier<Inputs> branched;
+  for (int v = 0; v < static_cast<int>(ALUVariable::VARIABLE_COUNT); ++v) {
+    branched.variables[v].resize(count * digit_count);
+  }
+  branched.inputs.resize(count * digit_count);
+
+  // The states for each digit make a run, so each variable is copied a run at a time
+  for (size_t d = 0; d < digit_count; ++d) {
+    for (int v = 0; v < static_cast<int>(ALUVariable::VARIABLE_COUNT); ++v) {
+      if (v == variable) {
+        fill(branched.variables[v].begin() + d * count, branched.variables[v].begin() + (d + 1) * count, possible_input_digits[d]);
+      }
+      else {
+        copy(frontier.variables[v].begin(), frontier.variables[v].end(), branched.variables[v].begin() + d * count);
+      }
+    }
+    for (size_t s = 0; s < count; ++s) {
+      branched.inputs[d * count + s] = AppendInput(frontier.inputs[s], possible_input_digits[d]);
+    }
+  }
+  return branched;
+}
+
+// MergeFrontier returns the frontier with the states whose z is too big to be valid dropped, and each state that is there more than once merged into one,
+// keeping the preferred inputs, based on the comparison function
+AluFrontier<model_number_prefix> MergeFrontier(AluFrontier<model_number_prefix>& frontier, const long long int max_possibly_valid_z_value, comparison compare_func) {
+  const vector<long long int>* variables = frontier.variables;
+  vector<size_t> order;
+  order.reserve(frontier.Size());
+  for (size_t s = 0; s < frontier.Size(); ++s) {
+    if (variables[static_cast<int>(ALUVariable::z)][s] <= max_possibly_valid_z_value) {
+      order.push_back(s);
+    }
+  }
+  auto same_state = [variables](const size_t s, const size_t t) {
+    for (int v = 0; v < static_cast<int>(ALUVariable::VARIABLE_COUNT); ++v) {
+      if (variables[v][s] != variables[v][t]) {
+        return false;
+      }
+    }
+    return true;
+  };
+  sort(order.begin(), order.end(), [variables](const size_t s, const size_t t) {
+    for (int v = static_cast<int>(ALUVariable::VARIABLE_COUNT) - 1; v >= 0; --v) {
+      if (variables[v][s] != variables[v][t]) {
+        return variables[v][s] < variables[v][t];
+      }
+    }
+    return false;
+  });
+
+  AluFrontier<model_number_prefix> merged;
+  for (size_t o = 0; o < order.size(); ) {
+    size_t preferred = order[o];
+    model_number_prefix preferred_number = frontier.inputs[preferred];
+    size_t next = o + 1;
+    for (; next < order.size() && same_state(order[next], preferred); ++next) {
+      const model_number_prefix number = frontier.inputs[order[next]];
+      if ((*compare_func)(number, preferred_number)) {
+        preferred = order[next];
+        preferred_number = number;
+      }
+    }
+    for (int v = 0; v < static_cast<int>(ALUVariable::VARIABLE_COUNT); ++v) {
+      merged.variables[v].push_back(variables[v][preferred]);
+    }
+    merged.inputs.push_back(preferred_number);
+    o = next;
+  }
+  return merged;
+}
+
+// ComputeValidModelNumberBatched returns the same model number as ComputeValidModelNumber, running each instruction on the whole frontier as a batch
+// Between inputs the states only change in place, so they are only pruned and merged before each input and at the end, rather than after every instruction
+long long int ComputeValidModelNumberBatched(const vector<AluInstruction>& program, comparison compare_func, long long int z_dividers_remaining) {
+  AOC_TIME_SCOPE("day24.compute_model_number_batched");
+  long long int max_possibly_valid_z_value = ComputeMaximumMultipliedZValue(z_dividers_remaining);
+
+  AluFrontier<model_number_prefix> frontier;
+  for (int v = 0; v < static_cast<int>(ALUVariable::VARIABLE_COUNT); ++v) {
+    frontier.variables[v].push_back(0);
+  }
+  frontier.inputs.push_back(0);
+
+  for (size_t n = 0; n < program.size(); ++n) {
+    const AluInstruction& i = program[n];
+    if (IsZDivider(i)) {
+      --z_dividers_remaining;
+      max_possibly_valid_z_value = ComputeMaximumMultipliedZValue(z_dividers_remaining);
+    }
+
+    AOC_COUNT("day24.instructions_run", 1);
+    AOC_HISTOGRAM("day24.states_per_instruction", frontier.Size());
+    if (i.operation == AluOperation::inp) {
+      frontier = BranchOnInput(MergeFrontier(frontier, max_possibly_valid_z_value, compare_func), i.a);
+    }
+    else {
+      RunBatch(i, frontier);
+    }
+  }
+  frontier = MergeFrontier(frontier, max_possibly_valid_z_value, compare_func);
+
+  // Determine which valid output has the preferred model number, according to given comparison function
+  long long int best_model_number = 0; // starting value is ok because 0 is not a valid model number (since no digit can be 0)
+  for (size_t s = 0; s < frontier.Size(); ++s) {
+    if (frontier.variables[static_cast<int>(ALUVariable::z)][s] == 0) {
+      long long int valid_model_number = frontier.inputs[s];
+      if (best_model_number == 0 || (*compare_func)(valid_model_number, best_model_number)) {
+        best_model_number = valid_model_number;
+      }
+    }
+  }
+
+  return best_model_number;
+}
+
+// StateKey is an ALU state as a hash map key
+class StateKey {
+  public:
+    long long int variables[static_cast<int>(ALUVariable::VARIABLE_COUNT)];
+
+    bool operator==(const StateKey& other) const {
+      for (int v = 0; v < static_cast<int>(ALUVariable::VARIABLE_COUNT); ++v) {
+        if (this->variables[v] != other.variables[v]) {
+          return false;
+        }
+      }
+      return true;
+    }
+};
+
+// StateKeyHash mixes every variable of the state into every bit of the hash (with the splitmix64 finalizer), since the hash also picks the state's shard
+class StateKeyHash {
+  public:
+    size_t operator()(const StateKey& key) const {
+      unsigned long long int hash = 0;
+      for (int v = 0; v < static_cast<int>(ALUVariable::VARIABLE_COUNT); ++v) {
+        hash = (hash ^ (unsigned long long int)key.variables[v]) + 0x9e3779b97f4a7c15ULL;
+        hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+        hash ^= hash >> 31;
+      }
+      return hash;
+    }
+};
+
+// FrontierShard is the part of the parallel frontier that one shard owns: the states hashed to it, with the largest and smallest inputs to each,
+// and once its instructions have run, which of its states it is sending to each shard to be merged
+template <typename Inputs>
+class FrontierShard {
+  public:
+    AluFrontier<Inputs> states;
+    vector<vector<size_t>> outbox; // entry p lists the states that shard p owns
+
+    // Take moves the states merged for this shard into it, leaving merged empty for the next merge
+    void Take(FrontierShard& merged) {
+      this->states = move(merged.states);
+      merged.states = AluFrontier<Inputs>();
+    }
+};
+
+// MergeInto keeps the larger of the largest inputs and the smaller of the smallest, if those given to the state are preferred
+void MergeInto(InputRange& kept, const InputRange& other) {
+  if (other.largest > kept.largest) {
+    kept.largest = other.largest;
+  }
+  if (other.smallest < kept.smallest) {
+    kept.smallest = other.smallest;
+  }
+}
+
+// RunSegment runs the instructions from first up to last on a shard's states, then sends each state that could still be valid to the shard that owns it
+template <typename Inputs>
+void RunSegment(FrontierShard<Inputs>& shard, const vector<AluInstruction>& program, const size_t first, const size_t last,
+  const long long int max_possibly_valid_z_value, const unsigned int shard_count) {
+  for (size_t n = first; n < last; ++n) {
+    if (program[n].operation == AluOperation::inp) {
+      shard.states = BranchOnInput(shard.states, program[n].a);
+    }
+    else {
+      RunBatch(program[n], shard.states);
+    }
+  }
+
+  shard.outbox.assign(shard_count, vector<size_t>());
+  StateKey key;
+  for (size_t s = 0; s < shard.states.Size(); ++s) {
+    for (int v = 0; v < static_cast<int>(ALUVariable::VARIABLE_COUNT); ++v) {
+      key.variables[v] = shard.states.variables[v][s];
+    }
+    if (key.variables[static_cast<int>(ALUVariable::z)] <= max_possibly_valid_z_value) {
+      shard.outbox[StateKeyHash()(key) % shard_count].push_back(s);
+    }
+  }
+}
+
+// MergeShard sets merged to the states sent to shard p, each kept once, with the preferred inputs of every copy of it that was sent
+// It only reads the other shards, so every shard can merge at once without locking
+template <typename Inputs>
+void MergeShard(const vector<FrontierShard<Inputs>>& shards, const unsigned int p, FrontierShard<Inputs>& merged) {
+  size_t incoming = 0;
+  for (auto& from:shards) {
+    incoming += from.outbox[p].size();
+  }
+  unordered_map<StateKey, size_t, StateKeyHash> index; // where each state is in merged
+  index.reserve(incoming);
+
+  StateKey key;
+  for (auto& from:shards) {
+    for (auto s:from.outbox[p]) {
+      for (int v = 0; v < static_cast<int>(ALUVariable::VARIABLE_COUNT); ++v) {
+        key.variables[v] = from.states.variables[v][s];
+      }
+      auto found = index.find(key);
+      if (found != index.end()) {
+        MergeInto(merged.states.inputs[found->second], from.states.inputs[s]);
+        continue;
+      }
+      index.emplace(key, merged.states.Size());
+      for (int v = 0; v < static_cast<int>(ALUVariable::VARIABLE_COUNT); ++v) {
+        merged.states.variables[v].push_back(key.variables[v]);
+      }
+      merged.states.inputs.push_back(from.states.inputs[s]);
+    }
+  }
+}
+
+// ComputeValidModelNumbersParallel returns both the largest and smallest valid model numbers, from one pass over the program that runs on the pool's threads
+// The frontier is split into a shard per thread, each kept a variable at a time and run in batches as in ComputeValidModelNumberBatched
+// The program is run a segment at a time, from one inp up to the next; in each, every shard runs the segment on its states, and sends each state to the shard
+// its hash picks, and then every shard merges the states sent to it; each step waits for the one before, so no shard needs a lock on another
+ModelNumberRange ComputeValidModelNumbersParallel(const vector<AluInstruction>& program, long long int z_dividers_remaining, ThreadPool& pool) {
+  AOC_TIME_SCOPE("day24.compute_model_numbers_parallel");
+  const unsigned int shard_count = pool.ThreadCount();
+  vector<FrontierShard<InputRange>> shards(shard_count), merged(shard_count);
+  for (int v = 0; v < static_cast<int>(ALUVariable::VARIABLE_COUNT); ++v) {
+    shards[0].states.variables[v].push_back(0);
+  }
+  shards[0].states.inputs.push_back(InputRange());
+
+  for (size_t first = 0; first < program.size(); ) {
+    size_t last = first + 1;
+    while (last < program.size() && program[last].operation != AluOperation::inp) {
+      ++last;
+    }
+    for (size_t n = first; n < last; ++n) {
+      if (IsZDivider(program[n])) {
+        --z_dividers_remaining;
+      }
+    }
+    const long long int max_possibly_valid_z_value = ComputeMaximumMultipliedZValue(z_dividers_remaining);
+    AOC_COUNT("day24.segments_run", 1);
+
+    for (unsigned int p = 0; p < shard_count; ++p) {
+      pool.Submit([&shards, &program, first, last, max_possibly_valid_z_value, shard_count, p]() {
+        RunSegment(shards[p], program, first, last, max_possibly_valid_z_value, shard_count);
+      });
+    }
+    pool.Wait();
+    for (unsigned int p = 0; p < shard_count; ++p) {
+      pool.Submit([&shards, &merged, p]() { MergeShard(shards, p, merged[p]); });
+    }
+    pool.Wait();
+
+    size_t states = 0;
+    for (unsigned int p = 0; p < shard_count; ++p) {
+      shards[p].Take(merged[p]);
+      states += shards[p].states.Size();
+    }
+    AOC_HISTOGRAM("day24.states_per_segment", states);
+    first = last;
+  }
+
+  ModelNumberRange range = {0, 0}; // 0 is not a valid model number (since no digit can be 0)
+  for (auto& shard:shards) {
+    for (size_t s = 0; s < shard.states.Size(); ++s) {
+      if (shard.states.variables[static_cast<int>(ALUVariable::z)][s] == 0) {
+        const long long int largest = shard.states.inputs[s].largest;
+        const long long int smallest = shard.states.inputs[s].smallest;
+        range.largest = max(range.largest, largest);
+        range.smallest = range.smallest == 0 ? smallest : min(range.smallest, smallest);
+      }
+    }
+  }
+  return range;
+}
+
+// MonadBlock is the part of the program that reads one digit: its inp instruction and those up to the next inp
+// A block is lifted only if it reads nothing left over from the blocks before it but z, so it is a function from z and its digit to the next z
+class MonadBlock {
+  public:
+    vector<AluInstruction> instructions; // starting with the inp
+    vector<AluInstruction> compiled; // the instructions compiled, with only z unknown before them
+    long long int z_divisor; // what the block's "div z" instructions divide z by, all together
+    bool monad_shaped; // whether the block is one of MONAD's, which never leave z below what their division leaves (see MatchesMonadShape)
+
+    MonadBlock(): z_divisor(1), monad_shaped(false) {}
+
+    // Run returns z after the block, given z before it and the digit it reads
+    long long int Run(const long long int z, const long long int digit) const {
+      long long int variables[static_cast<int>(ALUVariable::VARIABLE_COUNT)] = {0, 0, 0, 0};
+      variables[static_cast<int>(ALUVariable::z)] = z;
+      for (auto& i:this->compiled) {
+        if (i.operation == AluOperation::inp) {
+          variables[i.a] = digit;
+        }
+        else {
+          variables[i.a] = Evaluate(i.operation, variables[i.a], i.b == static_cast<int>(ALUVariable::VARIABLE_COUNT) ? i.literal : variables[i.b]);
+        }
+      }
+      return variables[static_cast<int>(ALUVariable::z)];
+    }
+};
+
+// MatchesMonadShape returns whether the block's instructions are those of every block in MONAD, which only differ in three literals:
+//   z is divided by 1 or 26, then x = (z mod 26 + a != w); z = z * (25x + 1) + (w + b) * x
+// b is not negative, so from a z that is not negative, such a block never leaves z below z divided by its divisor
+bool MatchesMonadShape(const vector<AluInstruction>& instructions) {
+  static const char* const kMonadBlock[] = {"inp w", "mul x 0", "add x z", "mod x 26", "div z 1", "add x 0", "eql x w", "eql x 0", "mul y 0",
+    "add y 25", "mul y x", "add y 1", "mul z y", "mul y 0", "add y w", "add y 0", "mul y x", "add z y"};
+  const size_t kMonadBlockSize = sizeof(kMonadBlock) / sizeof(kMonadBlock[0]);
+  const size_t kDivisor = 4, kOffset = 5, kIncrement = 15; // the literals that differ from block to block
+
+  if (instructions.size() != kMonadBlockSize) {
+    return false;
+  }
+  for (size_t i = 0; i < kMonadBlockSize; ++i) {
+    const AluInstruction expected = AluInstruction::Parse(kMonadBlock[i]);
+    const AluInstruction& actual = instructions[i];
+    if (actual.operation != expected.operation || actual.a != expected.a || actual.b != expected.b) {
+      return false;
+    }
+    if (i == kDivisor ? (actual.literal != 1 && actual.literal != z_multiplier) :
+        i == kIncrement ? actual.literal < 0 :
+        i != kOffset && actual.literal != expected.literal) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// LiftBlocks splits the parsed program into one block per digit, and compiles each
+// Throws invalid_argument if the program does not start with inp, or a block reads w, x or y before setting them
+vector<MonadBlock> LiftBlocks(const vector<AluInstruction>& program) {
+  vector<MonadBlock> blocks;
+  for (auto i:program) {
+    if (i.operation == AluOperation::inp) {
+      blocks.push_back(MonadBlock());
+    }
+    else if (blocks.empty()) {
+      throw invalid_argument("program must start by reading a digit");
+    }
+    else if (i.operation == AluOperation::div && i.a == static_cast<int>(ALUVariable::z) && i.b == static_cast<int>(ALUVariable::VARIABLE_COUNT)) {
+      blocks.back().z_divisor *= i.literal;
+    }
+    blocks.back().instructions.push_back(i);
+  }
+  if (blocks.empty() || blocks.size() > kMaxModelNumberDigits) {
+    throw invalid_argument("program must read between 1 and " + to_string(kMaxModelNumberDigits) + " digits");
+  }
+
+  // Follow which variables each block has set, starting with the one it reads its digit into
+  // Since only z carries over, Run starts the others at 0, which the compiled instructions can count on
+  const bool known[] = {true, true, true, false};
+  const long long int values[] = {0, 0, 0, 0};
+  for (auto& block:blocks) {
+    bool set[static_cast<int>(ALUVariable::VARIABLE_COUNT)] = {false, false, false, true}; // z carries over
+    for (auto i:block.instructions) {
+      for (int v = 0; v < static_cast<int>(ALUVariable::VARIABLE_COUNT); ++v) {
+        if (!set[v] && i.Reads(v)) {
+          throw invalid_argument("a digit's instructions must only use z from the digits before it");
+        }
+      }
+      set[i.a] = true;
+    }
+    block.compiled = CompileAlu(block.instructions, known, values);
+    block.monad_shaped = MatchesMonadShape(block.instructions);
+  }
+  return blocks;
+}
+
+// BlockSearch finds the preferred digits that take z to 0 through the lifted blocks, depth first, trying each block's digits in order of preference
+// The z values a block was entered with that cannot lead to 0 are remembered, so no block is searched from the same z twice
+// When every block is MONAD's, z can only be brought down to 0 by the blocks' "div z" instructions (a block never leaves z below what its
+// division leaves), so z entering a block must be less than the product of the divisors of it and the blocks after it; other programs are
+// searched without that limit
+class BlockSearch {
+  private:
+    const vector<MonadBlock>& blocks;
+    vector<long long int> z_limits; // entry b is the least z that block b cannot bring down to 0 by the end
+    vector<unordered_set<long long int>> dead_ends; // entry b holds the z values block b was entered with and could not bring to 0
+    long long int digits[9]; // in order of preference
+
+  public:
+    BlockSearch(const vector<MonadBlock>& b, comparison compare_func): blocks(b), z_limits(b.size() + 1, 1), dead_ends(b.size()) {
+      bool monad_shaped = true;
+      for (auto& block:this->blocks) {
+        monad_shaped = monad_shaped && block.monad_shaped;
+      }
+      for (int block = (int)this->blocks.size() - 1; block >= 0; --block) {
+        if (!monad_shaped) {
+          this->z_limits[block] = numeric_limits<long long int>::max();
+          continue;
+        }
+        const long long int divisor = abs(this->blocks[block].z_divisor);
+        this->z_limits[block] = this->z_limits[block+1] > numeric_limits<long long int>::max() / max(divisor, 1LL) ?
+          numeric_limits<long long int>::max() : this->z_limits[block+1] * max(divisor, 1LL);
+      }
+      for (int d = 0; d < 9; ++d) {
+        this->digits[d] = possible_input_digits[d];
+      }
+      sort(this->digits, this->digits + 9, compare_func);
+    }
+
+    // Search returns whether there are digits for blocks b onward that take z to 0, and appends the preferred ones to model_number
+    bool Search(const int block, const long long int z, long long int& model_number) {
+      if (block == this->blocks.size()) {
+        return z == 0;
+      }
+      if (z <= -this->z_limits[block] || z >= this->z_limits[block]) {
+        return false;
+      }
+      if (this->dead_ends[block].count(z) != 0) {
+        return false;
+      }
+
+      AOC_COUNT("day24.blocks_searched", 1);
+      for (auto digit:this->digits) {
+        long long int rest = model_number * 10 + digit;
+        if (this->Search(block + 1, this->blocks[block].Run(z, digit), rest)) {
+          model_number = rest;
+          return true;
+        }
+      }
+      this->dead_ends[block].insert(z);
+      return false;
+    }
+};
+
+// ComputeModelNumberFromBlocks uses the given comparison function to return the most preferred model number that is valid, by searching the lifted blocks
+// returns 0 if no model number is valid
+long long int ComputeModelNumberFromBlocks(const vector<MonadBlock>& blocks, comparison compare_func) {
+  AOC_TIME_SCOPE("day24.block_search");
+  BlockSearch search(blocks, compare_func);
+  long long int model_number = 0;
+  return search.Search(0, 0, model_number) ? model_number : 0;
+}
+
+// CountZDividers returns how many of the instructions bring z down a level
+long long int CountZDividers(const vector<AluInstruction>& program) {
+  long long int z_dividers = 0;
+  for (auto i:program) {
+    if (IsZDivider(i)) {
+      ++z_dividers;
+    }
+  }
+  return z_dividers;
+}
+
+// PuzzleInput is the MONAD program parsed once, and compiled or lifted for the strategy that will search it, so the parts share that work
+class PuzzleInput {
+  public:
+    vector<AluInstruction> compiled; // the whole program, for the frontiers
+    long long int z_dividers; // how many of the compiled instructions bring z down a level
+    vector<MonadBlock> blocks; // the program lifted into a block per digit, for block_analysis
+    once_flag range_once; // parallel_frontier finds both answers in one search, run by whichever part gets to it first
+    ModelNumberRange range;
+
+    PuzzleInput(): z_dividers(0) {}
+
+  private:
+    PuzzleInput(const PuzzleInput& other);
+    PuzzleInput& operator=(const PuzzleInput& other);
+};
+
+// ParsePuzzleInput sets input to the program in the lines, ready for the strategy to search
+// Throws invalid_argument if the program cannot be run, or with block_analysis, cannot be lifted into blocks
+void ParsePuzzleInput(const vector<string>& lines, const SearchStrategy strategy, PuzzleInput& input) {
+  const vector<AluInstruction> program = ParseProgram(lines);
+  if (strategy == SearchStrategy::block_analysis) {
+    input.blocks = LiftBlocks(program);
+  }
+  else {
+    input.compiled = CompileProgram(program);
+    input.z_dividers = CountZDividers(input.compiled);
+  }
+}
+
+// SearchModelNumbers returns both the largest and smallest model numbers for the parsed input, in one pass if the strategy can find both at once
+ModelNumberRange SearchModelNumbers(const PuzzleInput& input, const SearchStrategy strategy, const unsigned int threads);
+
+// SearchModelNumber returns the largest (or smallest) model number for the parsed input
+long long int SearchModelNumber(const PuzzleInput& input, const bool largest, const SearchStrategy strategy, const unsigned int threads) {
+  comparison compare_func = largest ? &AGreaterThanB : &ALessThanB;
+  switch (strategy) {
+    case SearchStrategy::state_frontier: return ComputeValidModelNumber(input.compiled, compare_func, input.z_dividers);
+    case SearchStrategy::batched_frontier: return ComputeValidModelNumberBatched(input.compiled, compare_func, input.z_dividers);
+    case SearchStrategy::parallel_frontier: {
+      const ModelNumberRange range = SearchModelNumbers(input, strategy, threads);
+      return largest ? range.largest : range.smallest;
+    }
+    default: return ComputeModelNumberFromBlocks(input.blocks, compare_func);
+  }
+}
+
+ModelNumberRange SearchModelNumbers(const PuzzleInput& input, const SearchStrategy strategy, const unsigned int threads) {
+  if (strategy == SearchStrategy::parallel_frontier) {
+    ThreadPool pool(threads);
+    return ComputeValidModelNumbersParallel(input.compiled, input.z_dividers, pool);
+  }
+  ModelNumberRange range = {SearchModelNumber(input, true, strategy, threads), SearchModelNumber(input, false, strategy, threads)};
+  return range;
+}
+
+long long int ValidModelNumber(const vector<string>& program, const bool largest, const SearchStrategy strategy, const unsigned int threads) {
+  PuzzleInput input;
+  ParsePuzzleInput(program, strategy, input);
+  return SearchModelNumber(input, largest, strategy, threads);
+}
+
+ModelNumberRange ValidModelNumbers(const vector<string>& program, const SearchStrategy strategy, const unsigned int threads) {
+  PuzzleInput input;
+  ParsePuzzleInput(program, strategy, input);
+  return SearchModelNumbers(input, strategy, threads);
+}
+
+void Day24Solver::Parse(const vector<LineView>& lines) {
+  vector<string> program;
+  program.reserve(lines.size());
+  for (auto line:lines) {
+    program.push_back(line.ToString());
+  }
+
+  // The program is compiled, or lifted into a block per digit, once for both parts; the state frontier takes any program, though only
+  // input-modified.txt in good time
+  delete this->input;
+  this->input = new PuzzleInput();
+  ParsePuzzleInput(program, this->strategy, *this->input);
+}
+
+// Part 1:
+// Pen-and-paper method led to answer 99994469899267, but I inevitably missed something, because it's too high
+// The state frontier took 16m15s on my machine, on input-modified.txt
+// The parallel frontier finds both parts' answers at once, so Part 2's is kept from Part 1
+long long int Day24Solver::SolvePart1() {
+  if (this->strategy == SearchStrategy::parallel_frontier) {
+    return this->BothModelNumbers().largest;
+  }
+  return SearchModelNumber(*this->input, true, this->strategy, this->threads);
+}
+
+// The state frontier took 11m0s on my machine, on input-modified.txt
+long long int Day24Solver::SolvePart2() {
+  if (this->strategy == SearchStrategy::parallel_frontier) {
+    return this->BothModelNumbers().smallest;
+  }
+  return SearchModelNumber(*this->input, false, this->strategy, this->threads);
+}
+
+// BothModelNumbers searches for both answers the first time it is called after Parse, and returns them from then on
+const ModelNumberRange& Day24Solver::BothModelNumbers() {
+  PuzzleInput& parsed = *this->input;
+  call_once(parsed.range_once, [this, &parsed]() { parsed.range = SearchModelNumbers(parsed, this->strategy, this->threads); });
+  return parsed.range;
+}
+
+Day24Solver::~Day24Solver() {
+  delete this->input;
+}
+
+} // namespace day24
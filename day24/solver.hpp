@@ -0,0 +1,73 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 24 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: What is the largest model number accepted by MONAD?
+// Part 2: What is the smallest model number accepted by MONAD?
+
+#ifndef DAY24_SOLVER_HPP_
+#define DAY24_SOLVER_HPP_
+
+#include "../util/solver.hpp" // Solver
+#include <string>
+#include <vector>
+
+namespace day24 {
+
+// SearchStrategy selects how the valid model numbers are searched for
+//   block_analysis lifts the program into a block per digit, each a function from z and the digit to the next z, and searches the digits depth first,
+//   remembering the z values each block cannot bring down to 0; it takes the original input.txt, and only when every block has MONAD's shape,
+//   skips the z values too large for the divisions left to bring down to 0
+//   state_frontier runs the program an instruction at a time over every ALU state reachable so far; it relies on the study of input.txt that went into
+//   input-modified.txt (see the explanatory comments there) to finish in minutes rather than much longer
+//   batched_frontier is state_frontier with the states kept a variable at a time, so each instruction runs over all of them in a batch,
+//   with AVX-512 or AVX2 when the machine has them; states are merged only before each input, instead of after every instruction
+//   parallel_frontier is batched_frontier split into a shard per thread, each owning the states its hash picks, and keeping both the largest and smallest
+//   inputs to each state, so both parts come out of one pass
+enum class SearchStrategy { block_analysis=0, state_frontier=1, batched_frontier=2, parallel_frontier=3 };
+
+// ModelNumberRange is the largest and smallest model numbers accepted by MONAD
+class ModelNumberRange {
+  public:
+    long long int largest;
+    long long int smallest;
+};
+
+// ValidModelNumber returns the largest (or smallest) model number the MONAD program accepts, or 0 if it accepts none
+// Lines that start with "#" are skipped; threads is the number of threads parallel_frontier uses, where 0 uses one per hardware thread
+// Throws std::invalid_argument if the program cannot be run, or with block_analysis, cannot be lifted into blocks
+long long int ValidModelNumber(const std::vector<std::string>& program, const bool largest, const SearchStrategy strategy, const unsigned int threads=0);
+
+// ValidModelNumbers returns both the largest and smallest model numbers, as ValidModelNumber does; parallel_frontier finds them in one pass
+ModelNumberRange ValidModelNumbers(const std::vector<std::string>& program, const SearchStrategy strategy, const unsigned int threads=0);
+
+class PuzzleInput;
+
+class Day24Solver : public Solver<long long int, long long int> {
+  private:
+    PuzzleInput* input; // the program, compiled or lifted once for both parts
+    SearchStrategy strategy;
+    unsigned int threads;
+
+    const ModelNumberRange& BothModelNumbers();
+
+    // the parsed input is owned by exactly one solver, so copying is not allowed
+    Day24Solver(const Day24Solver& other);
+    Day24Solver& operator=(const Day24Solver& other);
+
+  public:
+    explicit Day24Solver(const SearchStrategy s=SearchStrategy::block_analysis, const unsigned int t=0):
+      input(NULL), strategy(s), threads(t) {}
+
+    void Parse(const std::vector<LineView>& lines);
+    long long int SolvePart1();
+    long long int SolvePart2();
+
+    // parallel_frontier's Part 1 search also finds Part 2's answer
+    bool Part2DependsOnPart1() const { return this->strategy == SearchStrategy::parallel_frontier; }
+
+    ~Day24Solver();
+};
+
+} // namespace day24
+
+#endif // DAY24_SOLVER_HPP_
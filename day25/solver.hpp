@@ -0,0 +1,30 @@
+// solver.hpp: Laura Galbraith
+// Description: solver for Puzzles 1 and 2 of Day 25 of The Advent Of Code 2021
+// See: https://adventofcode.com/2021
+// Part 1: What is the first step on which no sea cucumbers move?
+// Part 2: Christmas!
+
+#ifndef DAY25_SOLVER_HPP_
+#define DAY25_SOLVER_HPP_
+
+#include "../util/solver.hpp" // Solver
+#include <string>
+#include <vector>
+
+namespace day25 {
+
+class Day25Solver : public Solver<int, std::string> {
+  private:
+    std::vector<std::string> sea_floor;
+
+  public:
+    void Parse(const std::vector<LineView>& lines);
+    int SolvePart1();
+    std::string SolvePart2(); // there is no puzzle for Part 2, so this throws logic_error
+
+    int PartCount() const { return 1; }
+};
+
+} // namespace day25
+
+#endif // DAY25_SOLVER_HPP_
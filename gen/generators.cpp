@@ -0,0 +1,843 @@
+// generators.cpp: Laura Galbraith
+// Description: generators of synthetic puzzle inputs for every day of The Advent Of Code 2021, for load testing the solvers
+// Each generator follows the rules the real inputs follow (see each day's puzzle), so every solver can find its answers
+
+#include "generators.hpp"
+#include <iostream>
+#include <algorithm>
+#include <cstdio> // snprintf
+#include <cstdlib> // abs
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace std;
+
+Random::Random(const unsigned long long int seed): engine(seed) {}
+
+long long int Random::Int(const long long int low, const long long int high) {
+  const unsigned long long int range = (unsigned long long int)(high - low) + 1;
+  return low + (long long int)(this->engine() % range); // the slight bias toward low values does not matter for test data
+}
+
+bool Random::Chance(const int numerator, const int denominator) {
+  return this->Int(1, denominator) <= numerator;
+}
+
+// DigitGrid writes size rows of size digits, each from low to high
+void DigitGrid(ostream& os, const long long int size, const int low, const int high, Random& random) {
+  string row(size, '0');
+  for (long long int r = 0; r < size; ++r) {
+    for (long long int c = 0; c < size; ++c) {
+      row[c] = '0' + random.Int(low, high);
+    }
+    os << row << "\n";
+  }
+}
+
+// Day 1: size depth measurements, mostly increasing
+int GenerateDay01(ostream& os, const long long int size, Random& random) {
+  long long int depth = random.Int(100, 200);
+  for (long long int i = 0; i < size; ++i) {
+    os << depth << "\n";
+    depth = max(0LL, depth + random.Int(-10, 15));
+  }
+  return 0;
+}
+
+// Day 2: size submarine commands, never rising above the surface
+int GenerateDay02(ostream& os, const long long int size, Random& random) {
+  long long int depth = 0;
+  for (long long int i = 0; i < size; ++i) {
+    const int amount = random.Int(1, 9);
+    const int kind = random.Int(0, 99);
+    if (kind < 40) {
+      os << "forward " << amount << "\n";
+    }
+    else if (kind < 75 || depth < amount) {
+      os << "down " << amount << "\n";
+      depth += amount;
+    }
+    else {
+      os << "up " << amount << "\n";
+      depth -= amount;
+    }
+  }
+  return 0;
+}
+
+// Day 3: size distinct 12-bit binary numbers
+// The solver finds each rating by repeatedly keeping the numbers with the most (or least) common bit in the next position,
+// so the numbers must be distinct, and for the CO2 scrubber rating, every position considered must have both bits among the numbers kept
+int GenerateDay03(ostream& os, const long long int size, Random& random) {
+  const int kBits = 12;
+  if (size > (1 << kBits)) {
+    cerr << "day03 inputs are distinct " << kBits << "-bit numbers, so there can be at most " << (1 << kBits) << " of them" << endl;
+    return -1;
+  }
+
+  vector<int> all_values(1 << kBits);
+  for (int i = 0; i < all_values.size(); ++i) {
+    all_values[i] = i;
+  }
+  random.Shuffle(all_values);
+  vector<int> values(all_values.begin(), all_values.begin() + size);
+
+  // Follow the CO2 scrubber rating's filtering, and wherever every kept number has the same bit, flip that bit in one of them
+  // Its flipped value cannot already be among the numbers (it would have been kept too), and the filtering before that bit is unchanged
+  bool fixed_all = false;
+  while (!fixed_all) {
+    fixed_all = true;
+    vector<int> kept;
+    for (int i = 0; i < values.size(); ++i) {
+      kept.push_back(i);
+    }
+    for (int bit = kBits-1; bit >= 0 && kept.size() > 1 && fixed_all; --bit) {
+      vector<int> ones, zeros;
+      for (auto i:kept) {
+        ((values[i] >> bit) & 1 ? ones : zeros).push_back(i);
+      }
+      if (ones.empty() || zeros.empty()) {
+        values[kept[random.Int(0, kept.size()-1)]] ^= 1 << bit;
+        fixed_all = false;
+      }
+      kept = zeros.size() <= ones.size() ? zeros : ones;
+    }
+  }
+
+  string binary(kBits, '0');
+  for (auto value:values) {
+    for (int b = 0; b < kBits; ++b) {
+      binary[kBits-1-b] = (value >> b) & 1 ? '1' : '0';
+    }
+    os << binary << "\n";
+  }
+  return 0;
+}
+
+// Day 4: size bingo boards of distinct numbers from 0 to 99, with every number drawn so that every board wins
+int GenerateDay04(ostream& os, const long long int size, Random& random) {
+  vector<int> numbers(100);
+  for (int i = 0; i < numbers.size(); ++i) {
+    numbers[i] = i;
+  }
+
+  random.Shuffle(numbers);
+  for (int i = 0; i < numbers.size(); ++i) {
+    os << (i > 0 ? "," : "") << numbers[i];
+  }
+  os << "\n";
+
+  char cell[4];
+  for (long long int b = 0; b < size; ++b) {
+    random.Shuffle(numbers);
+    os << "\n";
+    for (int row = 0; row < 5; ++row) {
+      for (int col = 0; col < 5; ++col) {
+        snprintf(cell, sizeof(cell), "%2d", numbers[row*5 + col]);
+        os << (col > 0 ? " " : "") << cell;
+      }
+      os << "\n";
+    }
+  }
+  return 0;
+}
+
+// Day 5: size horizontal, vertical, and diagonal line segments on a 1000x1000 grid
+int GenerateDay05(ostream& os, const long long int size, Random& random) {
+  const int kMax = 999;
+  for (long long int i = 0; i < size; ++i) {
+    int x1 = random.Int(0, kMax), y1 = random.Int(0, kMax);
+    int x2 = x1, y2 = y1;
+    const int kind = random.Int(0, 2);
+    if (kind == 0) {
+      while (x2 == x1) { x2 = random.Int(0, kMax); }
+    }
+    else if (kind == 1) {
+      while (y2 == y1) { y2 = random.Int(0, kMax); }
+    }
+    else {
+      // Diagonal lines are always at 45 degrees, so turn away from any edge the start is on
+      int dx = random.Chance(1, 2) ? 1 : -1, dy = random.Chance(1, 2) ? 1 : -1;
+      if ((dx > 0 && x1 == kMax) || (dx < 0 && x1 == 0)) { dx = -dx; }
+      if ((dy > 0 && y1 == kMax) || (dy < 0 && y1 == 0)) { dy = -dy; }
+      const int longest = min(dx > 0 ? kMax - x1 : x1, dy > 0 ? kMax - y1 : y1);
+      const int length = random.Int(1, longest);
+      x2 = x1 + dx*length;
+      y2 = y1 + dy*length;
+    }
+    os << x1 << "," << y1 << " -> " << x2 << "," << y2 << "\n";
+  }
+  return 0;
+}
+
+// Day 6: size lanternfish timers
+int GenerateDay06(ostream& os, const long long int size, Random& random) {
+  for (long long int i = 0; i < size; ++i) {
+    os << (i > 0 ? "," : "") << random.Int(1, 5);
+  }
+  os << "\n";
+  return 0;
+}
+
+// Day 7: size crab positions, spread over the same range as the real input
+int GenerateDay07(ostream& os, const long long int size, Random& random) {
+  for (long long int i = 0; i < size; ++i) {
+    os << (i > 0 ? "," : "") << random.Int(0, 1999);
+  }
+  os << "\n";
+  return 0;
+}
+
+// Day 8: size displays, each with its own random wiring of the seven segments
+int GenerateDay08(ostream& os, const long long int size, Random& random) {
+  const vector<string> kDigitSegments = {"abcefg", "cf", "acdeg", "acdfg", "bcdf", "abdfg", "abdefg", "acf", "abcdefg", "abcdfg"};
+
+  vector<char> wiring = {'a', 'b', 'c', 'd', 'e', 'f', 'g'};
+  vector<int> digits(kDigitSegments.size());
+  for (int d = 0; d < digits.size(); ++d) {
+    digits[d] = d;
+  }
+
+  for (long long int i = 0; i < size; ++i) {
+    random.Shuffle(wiring);
+    random.Shuffle(digits);
+
+    // Patterns list their segments in any order
+    auto pattern = [&](const int digit) {
+      vector<char> segments;
+      for (auto s:kDigitSegments[digit]) {
+        segments.push_back(wiring[s - 'a']);
+      }
+      random.Shuffle(segments);
+      return string(segments.begin(), segments.end());
+    };
+
+    for (auto d:digits) {
+      os << pattern(d) << " ";
+    }
+    os << "|";
+    for (int o = 0; o < 4; ++o) {
+      os << " " << pattern(random.Int(0, 9));
+    }
+    os << "\n";
+  }
+  return 0;
+}
+
+// Day 9: a size x size height map
+// Half the heights are 9s, so the basins between them stay small enough that multiplying the three largest sizes does not overflow
+int GenerateDay09(ostream& os, const long long int size, Random& random) {
+  string row(size, '0');
+  for (long long int r = 0; r < size; ++r) {
+    for (long long int c = 0; c < size; ++c) {
+      row[c] = random.Chance(1, 2) ? '9' : '0' + random.Int(0, 8);
+    }
+    os << row << "\n";
+  }
+  return 0;
+}
+
+// Day 10: size lines of chunks, each either corrupted or incomplete, with an odd number of incomplete lines (so there is a middle score)
+int GenerateDay10(ostream& os, const long long int size, Random& random) {
+  const string kOpeners = "([{<", kClosers = ")]}>";
+  const int kMaxOpen = 20; // keeps completion scores (5 to the power of the number of unclosed chunks) far from overflowing
+
+  vector<bool> incomplete(size);
+  long long int incomplete_count = 0;
+  for (long long int i = 0; i < size; ++i) {
+    incomplete[i] = random.Chance(1, 2);
+    incomplete_count += incomplete[i];
+  }
+  if (size > 0 && incomplete_count % 2 == 0) {
+    incomplete[size-1] = !incomplete[size-1];
+  }
+
+  for (long long int i = 0; i < size; ++i) {
+    const int length = random.Int(60, 110);
+    const int corrupt_at = incomplete[i] ? -1 : random.Int(length/4, length-1);
+    bool corrupted = false;
+    string line;
+    vector<int> open;
+    while (line.size() < length || open.empty() || (corrupt_at >= 0 && !corrupted)) {
+      if (!corrupted && corrupt_at >= 0 && line.size() >= corrupt_at && !open.empty()) {
+        line += kClosers[(open.back() + random.Int(1, 3)) % 4];
+        corrupted = true;
+      }
+      else if (open.empty() || (open.size() < kMaxOpen && random.Chance(11, 20))) {
+        open.push_back(random.Int(0, 3));
+        line += kOpeners[open.back()];
+      }
+      else {
+        line += kClosers[open.back()];
+        open.pop_back();
+      }
+    }
+    os << line << "\n";
+  }
+  return 0;
+}
+
+// OctopusSyncStep returns the first step on which every octopus flashes, or -1 if that does not happen within max_steps
+int OctopusSyncStep(vector<string> energies, const int max_steps) {
+  const int size = energies.size();
+  vector<pair<int,int>> flashing;
+  for (int step = 1; step <= max_steps; ++step) {
+    for (int r = 0; r < size; ++r) {
+      for (int c = 0; c < size; ++c) {
+        if (++energies[r][c] == '9' + 1) { flashing.push_back(pair<int,int>(r, c)); }
+      }
+    }
+
+    int flashes = 0;
+    while (!flashing.empty()) {
+      const pair<int,int> o = flashing.back();
+      flashing.pop_back();
+      ++flashes;
+      for (int r = max(0, o.first-1); r <= min(size-1, o.first+1); ++r) {
+        for (int c = max(0, o.second-1); c <= min(size-1, o.second+1); ++c) {
+          if (++energies[r][c] == '9' + 1) { flashing.push_back(pair<int,int>(r, c)); }
+        }
+      }
+    }
+
+    for (auto& row:energies) {
+      for (auto& e:row) {
+        e = e > '9' ? '0' : e;
+      }
+    }
+    if (flashes == size*size) {
+      return step;
+    }
+  }
+  return -1;
+}
+
+// Day 11: a size x size grid of octopus energy levels, which all flash together within a few thousand steps
+// Large random grids may never synchronize, so each retry sets more of the octopuses to one shared level (a grid of equal levels flashes together at once)
+int GenerateDay11(ostream& os, const long long int size, Random& random) {
+  const int kMaxSteps = 2000;
+  vector<string> energies(size, string(size, '0'));
+  for (int attempt = 0; ; ++attempt) {
+    const char shared_level = '0' + random.Int(0, 9);
+    for (auto& row:energies) {
+      for (auto& e:row) {
+        e = attempt < 16 && random.Chance(1, 1 << attempt) ? '0' + random.Int(0, 9) : shared_level;
+      }
+    }
+    if (OctopusSyncStep(energies, kMaxSteps) > 0) {
+      break;
+    }
+  }
+
+  for (auto row:energies) {
+    os << row << "\n";
+  }
+  return 0;
+}
+
+// Day 12: a cave system with size caves besides start and end, about a quarter of them big
+// Big caves are never connected to each other, since then paths could visit them forever
+int GenerateDay12(ostream& os, const long long int size, Random& random) {
+  if (size < 1) {
+    cerr << "day12 needs at least one cave between start and end" << endl;
+    return -1;
+  }
+  if (size > 26*26) {
+    cerr << "day12 cave names are two letters, so there can be at most " << 26*26 << " caves" << endl;
+    return -1;
+  }
+
+  vector<string> caves = {"start", "end"};
+  vector<bool> big = {false, false};
+  vector<int> names(26*26);
+  for (int n = 0; n < names.size(); ++n) {
+    names[n] = n;
+  }
+  random.Shuffle(names);
+  for (long long int c = 0; c < size; ++c) {
+    const bool is_big = c % 4 == 0;
+    const char base = is_big ? 'A' : 'a';
+    caves.push_back(string(1, base + names[c] / 26) + string(1, base + names[c] % 26));
+    big.push_back(is_big);
+  }
+
+  // Connect every cave to one placed before it, with end placed last, so end can be reached; then add about half as many edges again
+  // start is never connected straight to end
+  set<pair<int,int>> edges;
+  auto add_edge = [&](const int a, const int b) {
+    if (a == b || (big[a] && big[b]) || min(a, b) + max(a, b) == 1) { return false; }
+    return edges.insert(pair<int,int>(min(a, b), max(a, b))).second;
+  };
+  vector<int> order;
+  for (int c = 2; c < caves.size(); ++c) {
+    order.push_back(c);
+  }
+  random.Shuffle(order);
+  order.insert(order.begin(), 0);
+  order.push_back(1);
+  for (int o = 1; o < order.size(); ++o) {
+    int other = order[random.Int(o == order.size()-1 && o > 1 ? 1 : 0, o-1)];
+    while (big[order[o]] && big[other]) { other = order[random.Int(0, o-1)]; } // start is small, so this ends
+    add_edge(order[o], other);
+  }
+  for (long long int e = 0; e < size/2; ++e) {
+    add_edge(random.Int(0, caves.size()-1), random.Int(0, caves.size()-1));
+  }
+
+  vector<pair<int,int>> edge_list(edges.begin(), edges.end());
+  random.Shuffle(edge_list);
+  for (auto e:edge_list) {
+    if (random.Chance(1, 2)) { swap(e.first, e.second); }
+    os << caves[e.first] << "-" << caves[e.second] << "\n";
+  }
+  return 0;
+}
+
+// Day 13: size dots on paper that folds in half, alternately along x and y, down to an 80x6 code
+// Paper is about 256 times larger than the number of dots (the real input is sparser still), and no dot is ever on a fold line
+int GenerateDay13(ostream& os, const long long int size, Random& random) {
+  long long int width = 40, height = 6;
+  vector<pair<char,long long int>> unfolds;
+  while (width * height < 256 * size || unfolds.size() < 2) {
+    if (unfolds.size() % 2 == 0) {
+      unfolds.push_back(pair<char,long long int>('x', width));
+      width = 2*width + 1;
+    }
+    else {
+      unfolds.push_back(pair<char,long long int>('y', height));
+      height = 2*height + 1;
+    }
+  }
+  vector<pair<char,long long int>> folds(unfolds.rbegin(), unfolds.rend());
+
+  // The far corner dot makes the paper its full size; it folds onto 0, so it is never on a later fold line
+  os << width-1 << "," << height-1 << "\n";
+  for (long long int d = 1; d < size; ++d) {
+    long long int x, y;
+    bool on_fold = true;
+    while (on_fold) {
+      x = random.Int(0, width-1);
+      y = random.Int(0, height-1);
+      on_fold = false;
+      long long int fx = x, fy = y;
+      for (auto f:folds) {
+        long long int& coordinate = f.first == 'x' ? fx : fy;
+        on_fold = on_fold || coordinate == f.second;
+        coordinate = coordinate > f.second ? 2*f.second - coordinate : coordinate;
+      }
+    }
+    os << x << "," << y << "\n";
+  }
+
+  os << "\n";
+  for (auto f:folds) {
+    os << "fold along " << f.first << "=" << f.second << "\n";
+  }
+  return 0;
+}
+
+// Day 14: a polymer template of size elements, with an insertion rule for every pair of the 10 elements
+int GenerateDay14(ostream& os, const long long int size, Random& random) {
+  const string kElements = "BCFHKNOPSV";
+  string polymer(size, 'B');
+  for (long long int i = 0; i < size; ++i) {
+    polymer[i] = kElements[random.Int(0, kElements.size()-1)];
+  }
+  os << polymer << "\n\n";
+
+  for (auto a:kElements) {
+    for (auto b:kElements) {
+      os << a << b << " -> " << kElements[random.Int(0, kElements.size()-1)] << "\n";
+    }
+  }
+  return 0;
+}
+
+// Day 15: a size x size risk map
+int GenerateDay15(ostream& os, const long long int size, Random& random) {
+  DigitGrid(os, size, 1, 9, random);
+  return 0;
+}
+
+// BitWriter collects the bits of a BITS transmission
+class BitWriter {
+  public:
+    vector<bool> bits;
+
+    void Write(const unsigned long long int value, const int width) {
+      for (int b = width-1; b >= 0; --b) {
+        this->bits.push_back((value >> b) & 1);
+      }
+    }
+
+    void Append(const BitWriter& other) {
+      this->bits.insert(this->bits.end(), other.bits.begin(), other.bits.end());
+    }
+};
+
+// WritePacket writes a packet holding packets packets in total (itself included)
+// Operators give most of their packets to one sub-packet, so the packets nest deeply; below kMaxNesting they spread out instead,
+// so that the nesting stays within what a recursive decoder can handle
+void WritePacket(BitWriter& writer, const long long int packets, const int nesting, Random& random) {
+  const int kMaxNesting = 200;
+  const int kMaxSubpackets = 2047; // largest count in an 11-bit field
+
+  writer.Write(random.Int(0, 7), 3); // version
+  if (packets == 1) {
+    writer.Write(4, 3);
+    const int groups = random.Int(1, 5);
+    const unsigned long long int value = random.Int(0, (1LL << (4*groups)) - 1);
+    for (int g = groups-1; g >= 0; --g) {
+      writer.Write(g > 0 ? 1 : 0, 1);
+      writer.Write((value >> (4*g)) & 0xF, 4);
+    }
+    return;
+  }
+
+  // Comparisons need exactly two sub-packets; the others can have any number
+  const long long int children_packets = packets - 1;
+  long long int children;
+  int type;
+  if (children_packets >= 2 && random.Chance(1, 4)) {
+    type = random.Int(5, 7);
+    children = 2;
+  }
+  else {
+    const int kTypes[] = {0, 0, 1, 2, 3}; // sums are most common, as in the real input
+    type = kTypes[random.Int(0, 4)];
+    children = nesting < kMaxNesting ? random.Int(1, min(4LL, children_packets)) : min(children_packets, (long long int)kMaxSubpackets);
+  }
+  writer.Write(type, 3);
+
+  vector<long long int> sizes(children, 1);
+  long long int spare = children_packets - children;
+  if (nesting < kMaxNesting) {
+    sizes[random.Int(0, children-1)] += spare - spare/4;
+    spare /= 4;
+  }
+  for (long long int c = 0; spare > 0; c = (c+1) % children) {
+    const long long int extra = nesting < kMaxNesting ? random.Int(0, spare) : (spare + children - 1) / children;
+    sizes[c] += min(extra, spare);
+    spare -= min(extra, spare);
+  }
+
+  BitWriter sub_packets;
+  for (auto s:sizes) {
+    WritePacket(sub_packets, s, nesting+1, random);
+  }
+
+  if (sub_packets.bits.size() < (1 << 15) && random.Chance(1, 2)) {
+    writer.Write(0, 1);
+    writer.Write(sub_packets.bits.size(), 15);
+  }
+  else {
+    writer.Write(1, 1);
+    writer.Write(children, 11);
+  }
+  writer.Append(sub_packets);
+}
+
+// Day 16: one BITS transmission whose outermost packet holds size packets in total
+int GenerateDay16(ostream& os, const long long int size, Random& random) {
+  if (size < 1) {
+    cerr << "day16 transmissions hold at least one packet" << endl;
+    return -1;
+  }
+
+  BitWriter writer;
+  WritePacket(writer, size, 0, random);
+  while (writer.bits.size() % 8 != 0) {
+    writer.bits.push_back(false);
+  }
+
+  const char kHex[] = "0123456789ABCDEF";
+  string hex(writer.bits.size() / 4, '0');
+  for (size_t h = 0; h < hex.size(); ++h) {
+    int digit = 0;
+    for (int b = 0; b < 4; ++b) {
+      digit = (digit << 1) | writer.bits[h*4 + b];
+    }
+    hex[h] = kHex[digit];
+  }
+  os << hex << "\n";
+  return 0;
+}
+
+// Day 17: a target area about size units away horizontally, and half that below the probe
+int GenerateDay17(ostream& os, const long long int size, Random& random) {
+  if (size < 8) {
+    cerr << "day17 targets must be at least 8 units away" << endl;
+    return -1;
+  }
+
+  const long long int x1 = random.Int(size, size + size/2);
+  const long long int x2 = x1 + random.Int(size/4, size/3);
+  const long long int y1 = -random.Int(size*4/10, size/2);
+  const long long int y2 = y1 + random.Int(size/8, size/6);
+  os << "target area: x=" << x1 << ".." << x2 << ", y=" << y1 << ".." << y2 << "\n";
+  return 0;
+}
+
+// SnailfishNumber returns a reduced snailfish number: pairs nest at most 4 deep, and regular numbers are single digits
+string SnailfishNumber(const int depth, Random& random) {
+  if (depth == 4 || (depth > 0 && random.Chance(2, 5))) {
+    return to_string(random.Int(0, 9));
+  }
+  return "[" + SnailfishNumber(depth+1, random) + "," + SnailfishNumber(depth+1, random) + "]";
+}
+
+// Day 18: size snailfish numbers
+int GenerateDay18(ostream& os, const long long int size, Random& random) {
+  for (long long int i = 0; i < size; ++i) {
+    os << SnailfishNumber(0, random) << "\n";
+  }
+  return 0;
+}
+
+typedef tuple<long long int, long long int, long long int> Point3D;
+
+// Day 19: size scanners, each overlapping at least 12 beacons with one placed before it
+// Scanners are placed near one of the last few, so they spread out like in the real input rather than piling up around scanner 0;
+// each reports the beacons within 1000 units on every axis, rotated into one of its 24 orientations and in random order
+int GenerateDay19(ostream& os, const long long int size, Random& random) {
+  const long long int kRange = 1000;
+  const int kOverlap = 12;
+
+  vector<Point3D> scanners(1, Point3D(0, 0, 0));
+  set<Point3D> beacons;
+  auto visible = [&](const Point3D& scanner, const Point3D& beacon) {
+    return abs(get<0>(beacon) - get<0>(scanner)) <= kRange && abs(get<1>(beacon) - get<1>(scanner)) <= kRange && abs(get<2>(beacon) - get<2>(scanner)) <= kRange;
+  };
+  auto random_beacon = [&](const Point3D& low, const Point3D& high) {
+    return Point3D(random.Int(get<0>(low), get<0>(high)), random.Int(get<1>(low), get<1>(high)), random.Int(get<2>(low), get<2>(high)));
+  };
+
+  for (long long int s = 0; s < size; ++s) {
+    if (s > 0) {
+      const Point3D parent = scanners[random.Int(max(0LL, s-3), s-1)];
+      Point3D offset(random.Int(-1100, 1100), random.Int(-1100, 1100), random.Int(-1100, 1100));
+      get<0>(offset) += get<0>(offset) < 0 ? -100 : 100; // keep scanners from sitting on top of each other
+      const Point3D scanner(get<0>(parent) + get<0>(offset), get<1>(parent) + get<1>(offset), get<2>(parent) + get<2>(offset));
+
+      // The region both scanners can see
+      const Point3D low(max(get<0>(parent), get<0>(scanner)) - kRange, max(get<1>(parent), get<1>(scanner)) - kRange, max(get<2>(parent), get<2>(scanner)) - kRange);
+      const Point3D high(min(get<0>(parent), get<0>(scanner)) + kRange, min(get<1>(parent), get<1>(scanner)) + kRange, min(get<2>(parent), get<2>(scanner)) + kRange);
+      int shared = 0;
+      for (auto b:beacons) {
+        shared += visible(parent, b) && visible(scanner, b);
+      }
+      while (shared < kOverlap) {
+        shared += beacons.insert(random_beacon(low, high)).second;
+      }
+      scanners.push_back(scanner);
+    }
+
+    // A few beacons only this scanner (so far) can see
+    const Point3D& here = scanners.back();
+    const Point3D low(get<0>(here) - kRange, get<1>(here) - kRange, get<2>(here) - kRange);
+    const Point3D high(get<0>(here) + kRange, get<1>(here) + kRange, get<2>(here) + kRange);
+    for (int extra = random.Int(6, 14); extra > 0; ) {
+      extra -= beacons.insert(random_beacon(low, high)).second;
+    }
+  }
+
+  // The 24 orientations are the axis permutations and sign flips that are rotations (determinant +1)
+  vector<vector<int>> rotations; // each is {axis for x, axis for y, axis for z, sign x, sign y, sign z}
+  const int kPermutations[6][4] = {{0,1,2,1}, {1,2,0,1}, {2,0,1,1}, {0,2,1,-1}, {2,1,0,-1}, {1,0,2,-1}}; // last is the permutation's sign
+  for (auto p:kPermutations) {
+    for (int signs = 0; signs < 8; ++signs) {
+      const int sx = signs & 1 ? -1 : 1, sy = signs & 2 ? -1 : 1, sz = signs & 4 ? -1 : 1;
+      if (p[3] * sx * sy * sz == 1) {
+        rotations.push_back({p[0], p[1], p[2], sx, sy, sz});
+      }
+    }
+  }
+
+  for (long long int s = 0; s < size; ++s) {
+    const vector<int>& rotation = rotations[s == 0 ? 0 : random.Int(0, rotations.size()-1)];
+    vector<vector<long long int>> reports;
+    for (auto b:beacons) {
+      if (visible(scanners[s], b)) {
+        const long long int relative[3] = {get<0>(b) - get<0>(scanners[s]), get<1>(b) - get<1>(scanners[s]), get<2>(b) - get<2>(scanners[s])};
+        reports.push_back({rotation[3] * relative[rotation[0]], rotation[4] * relative[rotation[1]], rotation[5] * relative[rotation[2]]});
+      }
+    }
+    random.Shuffle(reports);
+
+    os << (s > 0 ? "\n" : "") << "--- scanner " << s << " ---\n";
+    for (auto r:reports) {
+      os << r[0] << "," << r[1] << "," << r[2] << "\n";
+    }
+  }
+  return 0;
+}
+
+// Day 20: an enhancement algorithm and a size x size image
+// If the algorithm lights pixels with no lit neighbors, it must turn off pixels whose neighbors are all lit, or the lit pixels would be infinite
+int GenerateDay20(ostream& os, const long long int size, Random& random) {
+  string algorithm(512, '.');
+  for (auto& a:algorithm) {
+    a = random.Chance(1, 2) ? '#' : '.';
+  }
+  if (algorithm[0] == '#') {
+    algorithm[511] = '.';
+  }
+  os << algorithm << "\n\n";
+
+  string row(size, '.');
+  for (long long int r = 0; r < size; ++r) {
+    for (auto& p:row) {
+      p = random.Chance(1, 2) ? '#' : '.';
+    }
+    os << row << "\n";
+  }
+  return 0;
+}
+
+// Day 21: two starting positions; the game is the same size whatever the input, so there is no size but 0
+int GenerateDay21(ostream& os, const long long int size, Random& random) {
+  if (size != 0) {
+    cerr << "day21 inputs are always two starting positions on the same board, so they have no size to choose" << endl;
+    return -1;
+  }
+
+  os << "Player 1 starting position: " << random.Int(1, 10) << "\n";
+  os << "Player 2 starting position: " << random.Int(1, 10) << "\n";
+  return 0;
+}
+
+// Day 22: size reboot steps; the first 20 stay in the initialization region (-50..50), like the real input, and the rest are large
+int GenerateDay22(ostream& os, const long long int size, Random& random) {
+  auto range = [&](const long long int low, const long long int high, const long long int min_length, const long long int max_length) {
+    const long long int start = random.Int(low, high - min_length);
+    const long long int end = min(high, start + random.Int(min_length, max_length));
+    return to_string(start) + ".." + to_string(end);
+  };
+
+  for (long long int i = 0; i < size; ++i) {
+    const bool initialization = i < 20;
+    const bool on = i == 0 || i == 20 || random.Chance(initialization ? 3 : 1, initialization ? 4 : 2);
+    os << (on ? "on" : "off");
+    if (initialization) {
+      os << " x=" << range(-50, 50, 5, 50) << ",y=" << range(-50, 50, 5, 50) << ",z=" << range(-50, 50, 5, 50) << "\n";
+    }
+    else {
+      os << " x=" << range(-100000, 100000, 5000, 40000) << ",y=" << range(-100000, 100000, 5000, 40000) << ",z=" << range(-100000, 100000, 5000, 40000) << "\n";
+    }
+  }
+  return 0;
+}
+
+// Day 23: two of each amphipod, arranged randomly (but not already sorted) in the four two-deep rooms; there is no size but 0,
+// since Part 2 always unfolds the burrow to the same depth
+int GenerateDay23(ostream& os, const long long int size, Random& random) {
+  if (size != 0) {
+    cerr << "day23 burrows are always four rooms two deep, since Part 2 unfolds them to the depth the solver expects, so they have no size to choose" << endl;
+    return -1;
+  }
+
+  string amphipods = "AABBCCDD";
+  vector<char> order(amphipods.begin(), amphipods.end());
+  do {
+    random.Shuffle(order);
+  } while (string(order.begin(), order.end()) == "ABCDABCD");
+
+  os << "#############\n";
+  os << "#...........#\n";
+  os << "###" << order[0] << "#" << order[1] << "#" << order[2] << "#" << order[3] << "###\n";
+  os << "  #" << order[4] << "#" << order[5] << "#" << order[6] << "#" << order[7] << "#\n";
+  os << "  #########\n";
+  return 0;
+}
+
+// Day 24: a MONAD program checking size-digit model numbers, written the way the real one is
+// Its z register works as a base-26 stack: half of the digit blocks push a digit plus an offset, and the other half pop one and
+// require their digit to be the popped digit plus an offset between -8 and 8, so valid model numbers always exist
+int GenerateDay24(ostream& os, const long long int size, Random& random) {
+  if (size < 2 || size % 2 != 0) {
+    cerr << "day24 model numbers must have an even number of digits, since each digit pushed on z must be popped by another" << endl;
+    return -1;
+  }
+
+  long long int pushes_left = size/2;
+  vector<int> pushed_offsets;
+  for (long long int d = 0; d < size; ++d) {
+    const bool push = pushes_left > 0 && (pushed_offsets.empty() || random.Chance(1, 2));
+    int divisor, check, offset = random.Int(1, 15);
+    if (push) {
+      --pushes_left;
+      divisor = 1;
+      check = random.Int(10, 15); // more than any digit, so the push always happens
+      pushed_offsets.push_back(offset);
+    }
+    else {
+      divisor = 26;
+      const int pushed_offset = pushed_offsets.back();
+      pushed_offsets.pop_back();
+      check = random.Int(-8, min(8, pushed_offset)) - pushed_offset;
+    }
+
+    os << "inp w\nmul x 0\nadd x z\nmod x 26\n";
+    os << "div z " << divisor << "\n";
+    os << "add x " << check << "\n";
+    os << "eql x w\neql x 0\nmul y 0\nadd y 25\nmul y x\nadd y 1\nmul z y\nmul y 0\nadd y w\n";
+    os << "add y " << offset << "\n";
+    os << "mul y x\nadd z y\n";
+  }
+  return 0;
+}
+
+// Day 25: a size x size trench of sea cucumbers, as crowded as the real one
+int GenerateDay25(ostream& os, const long long int size, Random& random) {
+  string row(size, '.');
+  for (long long int r = 0; r < size; ++r) {
+    for (auto& c:row) {
+      const int kind = random.Int(0, 99);
+      c = kind < 45 ? '.' : kind < 73 ? '>' : 'v';
+    }
+    os << row << "\n";
+  }
+  return 0;
+}
+
+const vector<GeneratorEntry>& AllGenerators() {
+  static const vector<GeneratorEntry> generators = {
+    {"day01", "depth measurements", 2000, &GenerateDay01},
+    {"day02", "commands", 1000, &GenerateDay02},
+    {"day03", "binary numbers (at most 4096)", 1000, &GenerateDay03},
+    {"day04", "bingo boards", 100, &GenerateDay04},
+    {"day05", "line segments", 500, &GenerateDay05},
+    {"day06", "lanternfish", 300, &GenerateDay06},
+    {"day07", "crabs", 1000, &GenerateDay07},
+    {"day08", "displays", 200, &GenerateDay08},
+    {"day09", "rows and columns of the height map", 100, &GenerateDay09},
+    {"day10", "lines", 106, &GenerateDay10},
+    {"day11", "rows and columns of octopuses", 10, &GenerateDay11},
+    {"day12", "caves besides start and end", 12, &GenerateDay12},
+    {"day13", "dots", 800, &GenerateDay13},
+    {"day14", "elements in the polymer template", 20, &GenerateDay14},
+    {"day15", "rows and columns of the risk map", 100, &GenerateDay15},
+    {"day16", "packets in the transmission", 250, &GenerateDay16},
+    {"day17", "distance to the target area", 200, &GenerateDay17},
+    {"day18", "snailfish numbers", 100, &GenerateDay18},
+    {"day19", "scanners", 37, &GenerateDay19},
+    {"day20", "rows and columns of the image", 100, &GenerateDay20},
+    {"day21", "none, the input is always the same size", 0, &GenerateDay21},
+    {"day22", "reboot steps", 420, &GenerateDay22},
+    {"day23", "none, the burrow is always four rooms two deep", 0, &GenerateDay23},
+    {"day24", "digits in the model number (even)", 14, &GenerateDay24},
+    {"day25", "rows and columns of the trench", 137, &GenerateDay25},
+  };
+  return generators;
+}
+
+const GeneratorEntry* FindGenerator(const string& name) {
+  for (const GeneratorEntry& entry:AllGenerators()) {
+    if (name == entry.name) {
+      return &entry;
+    }
+  }
+  return NULL;
+}
@@ -0,0 +1,56 @@
+// generators.hpp: Laura Galbraith
+// Description: generators of synthetic puzzle inputs for every day of The Advent Of Code 2021, for load testing the solvers
+// Each generator writes a valid input in its day's format; the same size and seed always give the same input, on any platform
+
+#ifndef GENERATORS_HPP_
+#define GENERATORS_HPP_
+
+#include <ostream>
+#include <random> // mt19937_64
+#include <string>
+#include <vector>
+
+// Random is a seeded source of random numbers
+// std::mt19937_64's output is fixed by the standard, but the standard distributions may differ between implementations,
+// so bounded values are computed here instead
+class Random {
+  public:
+    explicit Random(const unsigned long long int seed);
+
+    // Int returns a number from low to high, inclusive
+    long long int Int(const long long int low, const long long int high);
+
+    // Chance returns true with probability numerator/denominator
+    bool Chance(const int numerator, const int denominator);
+
+    // Shuffle puts the values in a random order
+    template <typename T>
+    void Shuffle(std::vector<T>& values) {
+      for (int i = (int)values.size() - 1; i > 0; --i) {
+        std::swap(values[i], values[this->Int(0, i)]);
+      }
+    }
+
+  private:
+    std::mt19937_64 engine;
+};
+
+// GeneratorEntry describes how to generate one day's input
+//   name is the day, like "day15"
+//   size_meaning says what the requested size counts, for the usage message
+//   default_size is a size similar to the checked-in input
+//   generate writes an input of the given size; it returns 0 on success, or -1 (after explaining why on stderr) if the size cannot be made
+struct GeneratorEntry {
+  const char* name;
+  const char* size_meaning;
+  long long int default_size;
+  int (*generate)(std::ostream& os, const long long int size, Random& random);
+};
+
+// AllGenerators returns every day's generator, in day order
+const std::vector<GeneratorEntry>& AllGenerators();
+
+// FindGenerator returns the entry for the given day name, or NULL if there is none
+const GeneratorEntry* FindGenerator(const std::string& name);
+
+#endif // GENERATORS_HPP_
@@ -0,0 +1,74 @@
+// main.cpp: Laura Galbraith
+// Description: writes synthetic puzzle inputs for The Advent Of Code 2021, of any size, for load testing the solvers
+// Usage: gen.out dayNN [SIZE] [--seed N] [--output FILE]
+//   SIZE defaults to about the size of the checked-in input; what it counts depends on the day (run with no arguments to list them)
+//   Day 21's and day 23's inputs are always the same size, so they reject any SIZE but 0
+//   The input is written to standard output unless an output file is given; the same day, size, and seed always give the same input
+// Example: './gen.out day15 1000 > big15.txt && ./day15_release.out big15.txt'
+
+#include "generators.hpp" // AllGenerators
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstdlib>
+
+using namespace std;
+
+const unsigned long long int kDefaultSeed = 2021;
+
+void PrintUsage(const char* program) {
+  cerr << "Usage: " << program << " dayNN [SIZE] [--seed N] [--output FILE]" << endl;
+  cerr << "SIZE is, for each day (with its default):" << endl;
+  for (const GeneratorEntry& entry:AllGenerators()) {
+    cerr << "  " << entry.name << ": " << entry.size_meaning << " (" << entry.default_size << ")" << endl;
+  }
+}
+
+int main(int argc, char** argv) {
+  ios::sync_with_stdio(false); // inputs can be large, and nothing else writes to standard output
+
+  const GeneratorEntry* generator = NULL;
+  long long int size = -1;
+  unsigned long long int seed = kDefaultSeed;
+  string output_file_name = "";
+
+  for (int a = 1; a < argc; ++a) {
+    string arg = argv[a];
+    if (arg == "--seed" && a + 1 < argc) {
+      seed = strtoull(argv[++a], NULL, 10);
+    }
+    else if (arg == "--output" && a + 1 < argc) {
+      output_file_name = argv[++a];
+    }
+    else if (generator == NULL && FindGenerator(arg) != NULL) {
+      generator = FindGenerator(arg);
+    }
+    else if (generator != NULL && size < 0 && arg.find_first_not_of("0123456789") == string::npos) {
+      size = atoll(arg.c_str());
+    }
+    else {
+      PrintUsage(argv[0]);
+      return -1;
+    }
+  }
+
+  if (generator == NULL) {
+    PrintUsage(argv[0]);
+    return -1;
+  }
+  if (size < 0) {
+    size = generator->default_size;
+  }
+
+  Random random(seed);
+  if (output_file_name == "") {
+    return generator->generate(cout, size, random);
+  }
+
+  ofstream output(output_file_name);
+  if (!output.is_open()) {
+    cerr << "Failed to open output file: " << output_file_name << endl;
+    return -1;
+  }
+  return generator->generate(output, size, random);
+}
@@ -0,0 +1,253 @@
+// main.cpp: Laura Galbraith
+// Description: runs the solvers for every day of The Advent Of Code 2021 concurrently, on a work-stealing thread pool
+// Usage: runner.out [--threads N] [--skip-slow] [dayNN ...]
+//   Must be run from the repo root, since every day's default input is found relative to it (like "dayNN/input.txt")
+//   With no days listed, every day is run; --threads defaults to one worker per hardware thread
+// Each day is split into tasks: parsing the input, then Part 1 and Part 2
+//   Part 2 waits for Part 1 when the day's solver says they share state; otherwise both start as soon as parsing is done
+//   The slow days are started first, since they decide how long the whole run takes
+// Reports every answer, each task's wall and CPU time, and the total time taken (the makespan), to help size the machines this runs on
+// When built with AOC_INSTRUMENT, also reports the solvers' instrumentation for the whole run
+
+#include "../util/registry.hpp" // AllSolvers
+#include "../util/fileutil.hpp" // MappedFile
+#include "../util/threadpool.hpp" // ThreadPool
+#include "../util/instrument.hpp" // instrument::Report
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <stdexcept>
+#include <cstdlib>
+#include <ctime>
+
+using namespace std;
+
+// ThreadCPUMilliseconds returns the CPU time used so far by the calling thread
+double ThreadCPUMilliseconds() {
+  timespec t;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+  return t.tv_sec * 1000.0 + t.tv_nsec / 1000000.0;
+}
+
+// TaskRecord is what one task did, for the report
+class TaskRecord {
+  public:
+    string part; // "parse", "1", or "2"
+    string answer;
+    int worker;
+    double start_ms; // since the run started
+    double wall_ms;
+    double cpu_ms;
+    bool ran;
+    bool failed;
+
+    TaskRecord(): worker(-1), start_ms(0), wall_ms(0), cpu_ms(0), ran(false), failed(false) {}
+};
+
+// DayRun holds one day's solver while its tasks run
+// Each record is only written by the task it describes, and is read once the pool has finished
+class DayRun {
+  public:
+    const SolverEntry* entry;
+    PuzzleSolver* solver;
+    MappedFile* file;
+    TaskRecord parse;
+    TaskRecord part1;
+    TaskRecord part2;
+
+    explicit DayRun(const SolverEntry* e): entry(e), solver(NULL), file(NULL) {
+      this->parse.part = "parse";
+      this->part1.part = "1";
+      this->part2.part = "2";
+    }
+
+    ~DayRun() {
+      delete this->solver;
+      delete this->file;
+    }
+
+  private:
+    // the solver and file are owned by exactly one run, so copying is not allowed
+    DayRun(const DayRun& other);
+    DayRun& operator=(const DayRun& other);
+};
+
+class Runner {
+  private:
+    ThreadPool pool;
+    chrono::steady_clock::time_point run_start;
+
+    // Timed runs the given work as the task described by record, catching any failure
+    template <typename Work>
+    void Timed(TaskRecord& record, Work work) {
+      record.worker = this->pool.CurrentWorker();
+      chrono::steady_clock::time_point start = chrono::steady_clock::now();
+      double cpu_start = ThreadCPUMilliseconds();
+      try {
+        work();
+      }
+      catch (const exception& e) {
+        record.failed = true;
+        record.answer = e.what();
+      }
+      record.cpu_ms = ThreadCPUMilliseconds() - cpu_start;
+      chrono::steady_clock::time_point end = chrono::steady_clock::now();
+      record.start_ms = chrono::duration<double, milli>(start - this->run_start).count();
+      record.wall_ms = chrono::duration<double, milli>(end - start).count();
+      record.ran = true;
+    }
+
+    void SolvePart(DayRun* day, const int part) {
+      TaskRecord& record = part == 1 ? day->part1 : day->part2;
+      this->Timed(record, [day, part, &record]() {
+        record.answer = part == 1 ? day->solver->Part1() : day->solver->Part2();
+      });
+
+      // A dependent Part 2 starts once Part 1 is done (even if it failed, Part 2 runs Part 1 again itself)
+      if (part == 1 && day->solver->PartCount() > 1 && day->solver->Part2DependsOnPart1()) {
+        this->pool.Submit([this, day]() { this->SolvePart(day, 2); });
+      }
+    }
+
+    void ParseInput(DayRun* day) {
+      this->Timed(day->parse, [day]() {
+        day->file = new MappedFile(day->entry->default_input_file);
+        if (day->file->Status() != FileStatus::ok) {
+          throw runtime_error(string("failed to read ") + day->entry->default_input_file + ": " + FileStatusMessage(day->file->Status()));
+        }
+        day->solver = day->entry->create();
+        day->solver->Parse(day->file->Lines());
+      });
+      if (day->parse.failed) {
+        return;
+      }
+
+      // Queue Part 2 last, so this worker runs it next, while Part 1 is nearer the front of the queue, where idle workers steal from
+      this->pool.Submit([this, day]() { this->SolvePart(day, 1); });
+      if (day->solver->PartCount() > 1 && !day->solver->Part2DependsOnPart1()) {
+        this->pool.Submit([this, day]() { this->SolvePart(day, 2); });
+      }
+    }
+
+  public:
+    explicit Runner(const unsigned int threads): pool(threads) {}
+
+    unsigned int ThreadCount() const { return this->pool.ThreadCount(); }
+
+    // Run solves every given day, slow days first, and returns the makespan in milliseconds
+    double Run(const vector<DayRun*>& days) {
+      this->run_start = chrono::steady_clock::now();
+      for (int pass = 0; pass < 2; ++pass) {
+        for (auto day:days) {
+          if (day->entry->slow == (pass == 0)) {
+            this->pool.Submit([this, day]() { this->ParseInput(day); });
+          }
+        }
+      }
+
+      this->pool.Wait();
+      return chrono::duration<double, milli>(chrono::steady_clock::now() - this->run_start).count();
+    }
+};
+
+void PrintRecord(const string& day, const TaskRecord& record) {
+  cout << left << setw(7) << day << setw(7) << record.part << right << setw(8) << record.worker
+    << fixed << setprecision(3) << setw(13) << record.start_ms << setw(13) << record.wall_ms << setw(13) << record.cpu_ms
+    << "  " << (record.failed ? "FAILED: " : "");
+
+  // Day 13's answer is drawn over several lines; keep the table readable by indenting them
+  for (auto c:record.answer) {
+    cout << c;
+    if (c == '\n') {
+      cout << string(63, ' ');
+    }
+  }
+  cout << endl;
+}
+
+int main(int argc, char** argv) {
+  int threads = 0;
+  bool skip_slow = false;
+  vector<string> selected_days;
+
+  for (int a = 1; a < argc; ++a) {
+    string arg = argv[a];
+    if (arg == "--threads" && a + 1 < argc) {
+      threads = atoi(argv[++a]);
+    }
+    else if (arg == "--skip-slow") {
+      skip_slow = true;
+    }
+    else if (arg.compare(0, 3, "day") == 0 && FindSolver(arg) != NULL) {
+      selected_days.push_back(arg);
+    }
+    else {
+      cout << "Usage: " << argv[0] << " [--threads N] [--skip-slow] [dayNN ...]" << endl;
+      return -1;
+    }
+  }
+
+  if (threads < 0) {
+    cout << "Number of threads cannot be negative" << endl;
+    return -1;
+  }
+
+  vector<DayRun*> days;
+  for (const SolverEntry& entry:AllSolvers()) {
+    if (!selected_days.empty() && find(selected_days.begin(), selected_days.end(), entry.name) == selected_days.end()) {
+      continue;
+    }
+    if (skip_slow && entry.slow) {
+      continue;
+    }
+    days.push_back(new DayRun(&entry));
+  }
+
+  Runner runner(threads);
+  double makespan_ms = runner.Run(days);
+
+  cout << left << setw(7) << "day" << setw(7) << "part" << right << setw(8) << "worker"
+    << setw(13) << "start ms" << setw(13) << "wall ms" << setw(13) << "CPU ms" << "  answer" << endl;
+
+  double total_cpu_ms = 0;
+  int status = 0;
+  for (auto day:days) {
+    const TaskRecord* records[] = {&day->parse, &day->part1, &day->part2};
+    for (auto record:records) {
+      if (!record->ran) {
+        continue; // a part of a day that failed to parse, or Day 25's Part 2
+      }
+      PrintRecord(day->entry->name, *record);
+      total_cpu_ms += record->cpu_ms;
+      if (record->failed) {
+        status = -1;
+      }
+    }
+    if (day->parse.failed) {
+      status = -1;
+    }
+  }
+
+  cout << endl << fixed << setprecision(3);
+  cout << "Threads: " << runner.ThreadCount() << endl;
+  cout << "Makespan: " << makespan_ms << " ms" << endl;
+  cout << "Total task CPU time: " << total_cpu_ms << " ms" << endl;
+  if (makespan_ms > 0) {
+    cout << "Average busy workers: " << setprecision(2) << total_cpu_ms / makespan_ms << " of " << runner.ThreadCount() << endl;
+  }
+
+  // The days ran at once, so the instrumented timers overlap; their totals are CPU-ish, not wall time
+  if (instrument::Enabled()) {
+    cout << endl;
+    instrument::Report(cout);
+  }
+
+  for (auto day:days) {
+    delete day;
+  }
+
+  return status;
+}
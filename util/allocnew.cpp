@@ -0,0 +1,54 @@
+// allocnew.cpp: Laura Galbraith
+// Description: replacement global operator new and delete that record every allocation with allocprof, for The Advent Of Code 2021
+// This is linked directly into the programs that want their allocations counted (bench.out, and the allocprof programs), not into the solver library,
+// since the replacement operators apply to the whole program that links them
+
+#include "allocprof.hpp" // RecordAllocation, RecordFree
+#include <new>
+#include <cstdlib>
+
+using namespace std;
+
+void* operator new(size_t size) {
+  allocprof::RecordAllocation(size, __builtin_return_address(0));
+  void* p = malloc(size == 0 ? 1 : size);
+  if (p == NULL) {
+    throw bad_alloc();
+  }
+  return p;
+}
+
+void* operator new[](size_t size) {
+  allocprof::RecordAllocation(size, __builtin_return_address(0));
+  void* p = malloc(size == 0 ? 1 : size);
+  if (p == NULL) {
+    throw bad_alloc();
+  }
+  return p;
+}
+
+void* operator new(size_t size, const nothrow_t&) noexcept {
+  allocprof::RecordAllocation(size, __builtin_return_address(0));
+  return malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](size_t size, const nothrow_t&) noexcept {
+  allocprof::RecordAllocation(size, __builtin_return_address(0));
+  return malloc(size == 0 ? 1 : size);
+}
+
+// Freeing NULL is allowed, and is not counted
+void operator delete(void* p) noexcept {
+  if (p != NULL) { allocprof::RecordFree(); }
+  free(p);
+}
+
+void operator delete[](void* p) noexcept {
+  if (p != NULL) { allocprof::RecordFree(); }
+  free(p);
+}
+
+void operator delete(void* p, size_t) noexcept { operator delete(p); }
+void operator delete[](void* p, size_t) noexcept { operator delete[](p); }
+void operator delete(void* p, const nothrow_t&) noexcept { operator delete(p); }
+void operator delete[](void* p, const nothrow_t&) noexcept { operator delete[](p); }
@@ -0,0 +1,241 @@
+// allocprof.cpp: Laura Galbraith
+// Description: allocation profile for the solvers for The Advent Of Code 2021; see allocprof.hpp
+
+#include "allocprof.hpp"
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <cxxabi.h> // __cxa_demangle
+#include <dlfcn.h> // dladdr
+
+using namespace std;
+
+namespace allocprof {
+
+// Size bucket b counts allocations of at most 8 << b bytes (and more than the bucket before it); the last bucket counts everything larger
+const int kSizeBuckets = 22;
+
+// Call sites are kept in a fixed-size open-addressing table, since recording must not allocate
+const int kCallSiteBits = 14;
+const int kCallSites = 1 << kCallSiteBits;
+
+// PhaseProfile is what was allocated while threads were in one phase
+class PhaseProfile {
+  public:
+    atomic<unsigned long long int> allocations;
+    atomic<unsigned long long int> bytes;
+    atomic<unsigned long long int> frees;
+    atomic<unsigned long long int> size_buckets[kSizeBuckets];
+};
+
+// CallSite is what was allocated from one return address; address is 0 while the slot is unused
+class CallSite {
+  public:
+    atomic<uintptr_t> address;
+    atomic<unsigned long long int> allocations;
+    atomic<unsigned long long int> bytes;
+};
+
+// These are zero-initialized before any code runs, so allocations made during static initialization are safe to record
+atomic<unsigned long long int> total_allocations;
+atomic<unsigned long long int> total_bytes;
+PhaseProfile phases[(int)Phase::PHASE_COUNT];
+CallSite call_sites[kCallSites];
+atomic<unsigned long long int> untracked_call_site_allocations; // made once the call site table filled up
+thread_local Phase current_phase = Phase::other;
+
+bool Enabled() {
+#ifdef AOC_ALLOCPROF
+  return true;
+#else
+  return false;
+#endif
+}
+
+// SizeBucket returns the size bucket that an allocation of the given size is counted in
+int SizeBucket(size_t size) {
+  int bucket = 0;
+  while (bucket < kSizeBuckets - 1 && size > ((size_t)8 << bucket)) {
+    ++bucket;
+  }
+  return bucket;
+}
+
+// RecordCallSite adds the allocation to its call site's slot, claiming a slot the first time the call site is seen
+void RecordCallSite(const void* caller, const size_t size) {
+  const uintptr_t address = (uintptr_t)caller;
+  size_t slot = (address * 0x9E3779B97F4A7C15ULL) >> (64 - kCallSiteBits);
+  for (int probe = 0; probe < kCallSites; ++probe, slot = (slot + 1) & (kCallSites - 1)) {
+    uintptr_t seen = call_sites[slot].address.load(memory_order_relaxed);
+    if (seen == 0 && call_sites[slot].address.compare_exchange_strong(seen, address, memory_order_relaxed)) {
+      seen = address;
+    }
+    if (seen == address) {
+      call_sites[slot].allocations.fetch_add(1, memory_order_relaxed);
+      call_sites[slot].bytes.fetch_add(size, memory_order_relaxed);
+      return;
+    }
+  }
+  untracked_call_site_allocations.fetch_add(1, memory_order_relaxed);
+}
+
+// Relaxed ordering is enough: the counts are only read for the report, once the allocating threads are done
+void RecordAllocation(const size_t size, const void* caller) {
+  total_allocations.fetch_add(1, memory_order_relaxed);
+  total_bytes.fetch_add(size, memory_order_relaxed);
+
+#ifdef AOC_ALLOCPROF
+  PhaseProfile& phase = phases[(int)current_phase];
+  phase.allocations.fetch_add(1, memory_order_relaxed);
+  phase.bytes.fetch_add(size, memory_order_relaxed);
+  phase.size_buckets[SizeBucket(size)].fetch_add(1, memory_order_relaxed);
+  RecordCallSite(caller, size);
+#endif
+}
+
+void RecordFree() {
+#ifdef AOC_ALLOCPROF
+  phases[(int)current_phase].frees.fetch_add(1, memory_order_relaxed);
+#endif
+}
+
+unsigned long long int AllocationCount() {
+  return total_allocations.load();
+}
+
+unsigned long long int AllocatedBytes() {
+  return total_bytes.load();
+}
+
+Phase SetPhase(const Phase phase) {
+  Phase previous = current_phase;
+  current_phase = phase;
+  return previous;
+}
+
+// Call sites are forgotten as well as their counts, so the table does not fill up over a long benchmark
+void Reset() {
+  for (int p = 0; p < (int)Phase::PHASE_COUNT; ++p) {
+    phases[p].allocations.store(0);
+    phases[p].bytes.store(0);
+    phases[p].frees.store(0);
+    for (int b = 0; b < kSizeBuckets; ++b) {
+      phases[p].size_buckets[b].store(0);
+    }
+  }
+  for (int s = 0; s < kCallSites; ++s) {
+    call_sites[s].address.store(0);
+    call_sites[s].allocations.store(0);
+    call_sites[s].bytes.store(0);
+  }
+  untracked_call_site_allocations.store(0);
+}
+
+// CallSiteTotals is a copy of a CallSite's counts, for the report
+class CallSiteTotals {
+  public:
+    uintptr_t address;
+    unsigned long long int allocations;
+    unsigned long long int bytes;
+
+    CallSiteTotals(const uintptr_t a, const unsigned long long int n, const unsigned long long int b): address(a), allocations(n), bytes(b) {}
+};
+
+// FunctionName returns the name of the function containing address, demangled, or the address itself if it has no exported symbol
+// The return address is just past the call, so the call itself is looked up one byte earlier
+string FunctionName(const uintptr_t address) {
+  Dl_info info;
+  if (dladdr((const void*)(address - 1), &info) == 0 || info.dli_sname == NULL) {
+    ostringstream os;
+    os << "0x" << hex << address;
+    if (info.dli_fname != NULL) {
+      os << " in " << info.dli_fname;
+    }
+    return os.str();
+  }
+
+  int status = 0;
+  char* demangled = abi::__cxa_demangle(info.dli_sname, NULL, NULL, &status);
+  string name = status == 0 ? demangled : info.dli_sname;
+  free(demangled);
+  return name;
+}
+
+// SizeBucketLabel names a size bucket by its largest size, like "<=64" or ">8M"
+string SizeBucketLabel(const int bucket) {
+  size_t limit = (size_t)8 << (bucket == kSizeBuckets - 1 ? bucket - 1 : bucket);
+  string prefix = bucket == kSizeBuckets - 1 ? ">" : "<=";
+  if (limit >= 1024 * 1024) {
+    return prefix + to_string(limit / (1024 * 1024)) + "M";
+  }
+  if (limit >= 1024) {
+    return prefix + to_string(limit / 1024) + "K";
+  }
+  return prefix + to_string(limit);
+}
+
+void Report(ostream& os, const int top_call_sites) {
+  if (!Enabled()) {
+    os << "(allocation profiling is not built in; build with AOC_ALLOCPROF)" << endl;
+    return;
+  }
+
+  const char* phase_names[] = { "other", "parse", "part1", "part2" };
+  os << left << setw(8) << "phase" << right << setw(14) << "allocations" << setw(14) << "frees" << setw(16) << "bytes" << "  sizes" << endl;
+  for (int p = 0; p < (int)Phase::PHASE_COUNT; ++p) {
+    if (phases[p].allocations.load() == 0 && phases[p].frees.load() == 0) {
+      continue;
+    }
+    os << left << setw(8) << phase_names[p] << right << setw(14) << phases[p].allocations.load()
+      << setw(14) << phases[p].frees.load() << setw(16) << phases[p].bytes.load() << " ";
+    for (int b = 0; b < kSizeBuckets; ++b) {
+      if (phases[p].size_buckets[b].load() > 0) {
+        os << " " << SizeBucketLabel(b) << ":" << phases[p].size_buckets[b].load();
+      }
+    }
+    os << endl;
+  }
+
+  // The call sites are copied out before naming them, since naming them allocates, which adds to the table
+  vector<CallSiteTotals> sites;
+  sites.reserve(kCallSites);
+  for (int s = 0; s < kCallSites; ++s) {
+    if (call_sites[s].address.load() != 0) {
+      sites.push_back(CallSiteTotals(call_sites[s].address.load(), call_sites[s].allocations.load(), call_sites[s].bytes.load()));
+    }
+  }
+
+  // Several call sites can be in one function, such as a vector growing from several places; they are reported together
+  map<string, pair<unsigned long long int, unsigned long long int>> by_function; // allocations and bytes per function
+  for (auto site:sites) {
+    pair<unsigned long long int, unsigned long long int>& function = by_function[FunctionName(site.address)];
+    function.first += site.allocations;
+    function.second += site.bytes;
+  }
+
+  vector<pair<unsigned long long int, string>> ranked; // allocations, function
+  for (auto f:by_function) {
+    ranked.push_back(make_pair(f.second.first, f.first));
+  }
+  sort(ranked.rbegin(), ranked.rend());
+
+  os << endl << right << setw(14) << "allocations" << setw(16) << "bytes" << "  call site (function containing the call to operator new)" << endl;
+  for (int i = 0; i < ranked.size() && i < top_call_sites; ++i) {
+    string name = ranked[i].second;
+    if (name.size() > 120) {
+      name = name.substr(0, 117) + "...";
+    }
+    os << setw(14) << ranked[i].first << setw(16) << by_function[ranked[i].second].second << "  " << name << endl;
+  }
+  if (untracked_call_site_allocations.load() > 0) {
+    os << setw(14) << untracked_call_site_allocations.load() << setw(16) << "?" << "  (call sites past the first " << kCallSites << ")" << endl;
+  }
+}
+
+} // namespace allocprof
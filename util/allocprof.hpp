@@ -0,0 +1,55 @@
+// allocprof.hpp: Laura Galbraith
+// Description: allocation profiling for the solvers for The Advent Of Code 2021: counts every allocation by phase, by size, and by call site
+// Allocations are only seen by programs that link util/allocnew.cpp, which replaces the global operator new and delete with ones that call in here
+// Without AOC_ALLOCPROF, only the total count and bytes are kept (bench.out uses these for its allocs/run column);
+// with it (the 'allocprof' configuration in the Makefile), each allocation is also bucketed by size, and attributed to its phase and its caller
+
+#ifndef ALLOCPROF_HPP_
+#define ALLOCPROF_HPP_
+
+#include <cstddef>
+#include <ostream>
+
+namespace allocprof {
+
+// Phase is the part of solving a day that a thread is working on; allocations are attributed to the phase of the thread making them
+enum class Phase { other=0, parse=1, part1=2, part2=3, PHASE_COUNT=4 };
+
+// Enabled is true when the library was built with AOC_ALLOCPROF, so there is a full profile to report
+bool Enabled();
+
+// RecordAllocation and RecordFree are called by the replacement operators for every allocation and free
+// caller is the return address of the code that called operator new; they do not allocate
+void RecordAllocation(const std::size_t size, const void* caller);
+void RecordFree();
+
+// AllocationCount and AllocatedBytes are the totals over every allocation since the program started
+unsigned long long int AllocationCount();
+unsigned long long int AllocatedBytes();
+
+// SetPhase sets the calling thread's phase, returning the phase it replaces
+Phase SetPhase(const Phase phase);
+
+// ScopedPhase sets the calling thread's phase until it is destroyed
+class ScopedPhase {
+  private:
+    Phase previous;
+
+    ScopedPhase(const ScopedPhase& other);
+    ScopedPhase& operator=(const ScopedPhase& other);
+
+  public:
+    explicit ScopedPhase(const Phase phase): previous(SetPhase(phase)) {}
+    ~ScopedPhase() { SetPhase(this->previous); }
+};
+
+// Reset zeros the profile (but not the totals), for example between the days of a benchmark
+void Reset();
+
+// Report prints the profile: each phase's allocations, frees, bytes, and sizes, then the call sites that allocated most often
+// Call sites are named by the function containing them, which needs the program's symbols to be exported (link with -rdynamic)
+void Report(std::ostream& os, const int top_call_sites=20);
+
+} // namespace allocprof
+
+#endif // ALLOCPROF_HPP_
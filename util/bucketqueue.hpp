@@ -0,0 +1,104 @@
+// bucketqueue.hpp: Laura Galbraith
+// Description: circular bucket queue (Dial's algorithm) for the searches in The Advent Of Code 2021 whose keys grow by small steps
+
+#ifndef BUCKET_QUEUE_HPP_
+#define BUCKET_QUEUE_HPP_
+
+#include <cstddef>
+#include <vector>
+
+// BucketQueue is a min-queue of ids from 0 up to the id count given at construction, keyed by non-negative ints
+// It has the same interface as IndexedHeap, but only works when the keys queued at any time are within a window:
+// each is at least the key last popped, and less than the lowest of them plus the span given at construction
+// That holds for shortest paths when the span is more than the largest edge cost (plus the largest change in the heuristic, for A*)
+// Each key has a bucket, and the buckets are reused round a circle as the lowest key moves up
+// A lowered key leaves its old entry behind, which is skipped once it is reached
+// Runtime complexity: O(1) to push, and O(1) amortized to pop (each bucket is passed over once per span of keys); memory is linear in the id count
+template <typename Id=unsigned int>
+class BucketQueue {
+  private:
+    static const int kNotQueued = -1;
+
+    std::vector<std::vector<Id>> buckets; // entry i holds the ids queued with a key equal to i modulo the bucket count
+    std::size_t bucket_mask; // the bucket count is a power of two, so a key's bucket is found with a mask
+    std::vector<int> queued_key; // the key each id is queued with, or kNotQueued
+    std::size_t live; // ids queued, not counting the entries left behind by lowered keys
+    int lowest_key; // no id is queued with a lower key than this, so Advance starts looking here
+
+    std::vector<Id>& BucketFor(const int key) { return this->buckets[key & this->bucket_mask]; }
+
+    static std::size_t BucketCount(const int key_span) {
+      std::size_t count = 1;
+      while (count < (std::size_t)key_span) {
+        count *= 2;
+      }
+      return count;
+    }
+
+    // Advance moves lowest_key up to the next bucket with an entry that has not been left behind, dropping the entries that have
+    void Advance() {
+      while (true) {
+        std::vector<Id>& bucket = this->BucketFor(this->lowest_key);
+        while (!bucket.empty() && this->queued_key[bucket.back()] != this->lowest_key) {
+          bucket.pop_back();
+        }
+        if (!bucket.empty()) {
+          return;
+        }
+        ++this->lowest_key;
+      }
+    }
+
+  public:
+    BucketQueue(const std::size_t id_count, const int key_span):
+      buckets(BucketCount(key_span)), bucket_mask(BucketCount(key_span) - 1), queued_key(id_count, kNotQueued), live(0), lowest_key(0) {}
+
+    // Grow raises the id count to the one given, for searches that number their nodes as they find them
+    void Grow(const std::size_t id_count) {
+      if (id_count > this->queued_key.size()) {
+        this->queued_key.resize(id_count, kNotQueued);
+      }
+    }
+
+    bool Empty() const { return this->live == 0; }
+    std::size_t Size() const { return this->live; }
+    bool Contains(const Id id) const { return this->queued_key[id] != kNotQueued; }
+
+    // Top returns an id with the lowest key, and TopKey that key; the queue must not be empty
+    Id Top() { this->Advance(); return this->BucketFor(this->lowest_key).back(); }
+    int TopKey() { this->Advance(); return this->lowest_key; }
+
+    // PushOrDecrease queues id with the given key, or lowers its key if it is already queued with a higher one
+    void PushOrDecrease(const Id id, const int key) {
+      if (this->live == 0 || key < this->lowest_key) {
+        this->lowest_key = key; // the window starts wherever the lowest key queued is
+      }
+
+      if (this->queued_key[id] == kNotQueued) {
+        ++this->live;
+      }
+      else if (key >= this->queued_key[id]) {
+        return;
+      }
+
+      this->queued_key[id] = key;
+      this->BucketFor(key).push_back(id);
+    }
+
+    // Pop removes and returns an id with the lowest key; the queue must not be empty
+    Id Pop() {
+      this->Advance();
+      std::vector<Id>& bucket = this->BucketFor(this->lowest_key);
+      const Id top = bucket.back();
+      bucket.pop_back();
+      this->queued_key[top] = kNotQueued;
+      --this->live;
+      return top;
+    }
+};
+
+// kNotQueued is passed by reference to vector's fill functions, so it needs a definition
+template <typename Id>
+const int BucketQueue<Id>::kNotQueued;
+
+#endif // BUCKET_QUEUE_HPP_
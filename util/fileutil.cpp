@@ -1,11 +1,23 @@
 // fileutil.cpp: Laura Galbraith
 // Description: useful file-related functions for The Advent Of Code 2021
 
+#include "fileutil.hpp"
 #include <tuple>
 #include <vector>
 #include <string>
 #include <fstream>
 #include <regex>
+#include <cstring>
+#include <climits>
+#include <algorithm> // count
+#include <fcntl.h> // open
+#include <sys/mman.h> // mmap, munmap, madvise
+#include <sys/stat.h> // fstat
+#include <unistd.h> // close, read
+#include <cerrno>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 using namespace std;
 
@@ -20,16 +32,31 @@ pair<vector<string>, int> ReadLinesFromFile(const string file_name) {
     }
   }
   else {
-    pair<vector<string>, int> error(NULL, -1);
+    pair<vector<string>, int> error(vector<string>(), -1);
     return error;
   }
 
-  pair<vector<string>, int> result(contents, 0);
+  pair<vector<string>, int> result(move(contents), 0); // move rather than copy every line into the result
   return result;
 }
 
 pair<vector<int>, int> ParseSeparatedInts(const string str, const string sep) {
   pair<vector<int>, int> results(vector<int>(), -1);
+
+  if (sep.size() == 1) {
+    // There can be at most one more int than there are separators, so one scan into the result is enough
+    results.first.resize(count(str.begin(), str.end(), sep[0]) + 1);
+    long long int int_count = ScanSeparatedInts(str.data(), str.data() + str.size(), sep[0], results.first.data(), results.first.size());
+    if (int_count < 0) {
+      results.first.clear();
+      return results;
+    }
+
+    results.first.resize(int_count);
+    results.second = 0;
+    return results;
+  }
+
   string remaining_str = str;
   smatch m;
   string regex_str = "([-]{0,1}\\d+)" + sep;
@@ -53,3 +80,214 @@ pair<vector<int>, int> ParseSeparatedInts(const string str, const string sep) {
   results.second = 0;
   return results;
 }
+
+// DigitRunLength returns how many characters starting at c are decimal digits, without reading past end
+static size_t DigitRunLength(const char* c, const char* end) {
+  const char* start = c;
+
+#ifdef __SSE2__
+  // Classify 16 characters at once: a character is a digit if (c - '0') is at most 9 as an unsigned byte
+  const __m128i zero_char = _mm_set1_epi8('0');
+  const __m128i nine = _mm_set1_epi8(9);
+  while (end - c >= 16) {
+    __m128i chars = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(c)), zero_char);
+    __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(chars, nine), chars);
+    unsigned int non_digits = ~_mm_movemask_epi8(is_digit) & 0xFFFF;
+    if (non_digits != 0) {
+      return (c - start) + __builtin_ctz(non_digits);
+    }
+    c += 16;
+  }
+#endif
+
+  while (c < end && *c >= '0' && *c <= '9') {
+    ++c;
+  }
+
+  return c - start;
+}
+
+long long int ScanSeparatedInts(const char* begin, const char* end, const char sep, int* out, const size_t capacity) {
+  long long int int_count = 0;
+  const char* c = begin;
+
+  while (c < end && *c == ' ') { ++c; }
+  while (c < end) {
+    // Parse one int: an optional '-' followed by at least one digit
+    bool negative = false;
+    if (*c == '-') {
+      negative = true;
+      ++c;
+    }
+
+    size_t digits = DigitRunLength(c, end);
+    if (digits == 0) {
+      return -1;
+    }
+
+    long long int value = 0;
+    for (const char* d = c; d < c + digits; ++d) {
+      value = value * 10 + (*d - '0');
+      if (value > (long long int)INT_MAX + 1) {
+        return -1; // would not fit in an int, which stoi would also have rejected
+      }
+    }
+    c += digits;
+
+    value = negative ? -value : value;
+    if (value > INT_MAX) {
+      return -1;
+    }
+    if ((size_t)int_count < capacity) {
+      out[int_count] = value;
+    }
+    ++int_count;
+
+    // Move past the separator to the next int; a space separator has already been skipped over
+    while (c < end && *c == ' ') { ++c; }
+    if (c < end && sep != ' ') {
+      if (*c != sep) {
+        return -1;
+      }
+      ++c;
+      while (c < end && *c == ' ') { ++c; }
+    }
+  }
+
+  return int_count;
+}
+
+vector<LineView> SplitLines(const char* text, const size_t length) {
+  // Count lines first so the line list is allocated exactly once
+  const char* end = text + length;
+  size_t line_count = 0;
+  for (const char* c = text; c < end; ++line_count) {
+    const char* newline = static_cast<const char*>(memchr(c, '\n', end - c));
+    c = newline == NULL ? end : newline + 1;
+  }
+
+  vector<LineView> lines;
+  lines.reserve(line_count);
+
+  // Like getline, a trailing '\n' does not start another (empty) line
+  for (const char* c = text; c < end;) {
+    const char* newline = static_cast<const char*>(memchr(c, '\n', end - c));
+    const char* line_end = newline == NULL ? end : newline;
+    lines.push_back(LineView(c, line_end - c));
+    c = line_end + 1;
+  }
+
+  return lines;
+}
+
+const char* FileStatusMessage(const FileStatus status) {
+  switch(status) {
+    case FileStatus::ok: return "ok";
+    case FileStatus::open_failed: return "file could not be opened";
+    case FileStatus::stat_failed: return "file size could not be determined";
+    case FileStatus::map_failed: return "file could not be memory-mapped";
+    case FileStatus::read_failed: return "file could not be read";
+    default: return "unknown file status";
+  }
+}
+
+MappedFile::MappedFile(const string& file_name): contents(NULL), length(0), status(FileStatus::ok) {
+  int fd = open(file_name.c_str(), O_RDONLY);
+  if (fd < 0) {
+    this->status = FileStatus::open_failed;
+    return;
+  }
+
+  struct stat file_info;
+  if (fstat(fd, &file_info) < 0) {
+    close(fd);
+    this->status = FileStatus::stat_failed;
+    return;
+  }
+
+  // mmap refuses zero-length mappings; an empty file is simply a file with no lines
+  this->length = file_info.st_size;
+  if (this->length == 0) {
+    close(fd);
+    return;
+  }
+
+  void* mapping = mmap(NULL, this->length, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd); // the mapping keeps its own reference to the file
+  if (mapping == MAP_FAILED) {
+    this->length = 0;
+    this->status = FileStatus::map_failed;
+    return;
+  }
+
+  this->contents = static_cast<const char*>(mapping);
+  madvise(mapping, this->length, MADV_SEQUENTIAL); // only a hint; lines are split front to back
+  this->lines = SplitLines(this->contents, this->length);
+}
+
+MappedFile::~MappedFile() {
+  if (this->contents != NULL) {
+    munmap(const_cast<char*>(this->contents), this->length);
+  }
+}
+
+LineSource::LineSource(const string& file_name): fd(-1), buffer(kChunkSize), line_start(0), scanned(0), filled(0), at_end(false), status(FileStatus::ok) {
+  this->fd = file_name == "-" ? STDIN_FILENO : open(file_name.c_str(), O_RDONLY);
+  if (this->fd < 0) {
+    this->status = FileStatus::open_failed;
+    this->at_end = true;
+  }
+}
+
+bool LineSource::NextLine(LineView& line) {
+  while (true) {
+    // Return the next complete line if there is one
+    const char* newline = static_cast<const char*>(memchr(this->buffer.data() + this->scanned, '\n', this->filled - this->scanned));
+    if (newline != NULL) {
+      const size_t line_end = newline - this->buffer.data();
+      line = LineView(this->buffer.data() + this->line_start, line_end - this->line_start);
+      this->line_start = this->scanned = line_end + 1;
+      return true;
+    }
+    this->scanned = this->filled;
+
+    // Like getline, the last line does not need a '\n'
+    if (this->at_end) {
+      if (this->line_start == this->filled) {
+        return false;
+      }
+      line = LineView(this->buffer.data() + this->line_start, this->filled - this->line_start);
+      this->line_start = this->filled;
+      return true;
+    }
+
+    // Move the partial line to the front of the buffer to make room to read more, growing the buffer only if the line fills it
+    if (this->line_start > 0) {
+      memmove(this->buffer.data(), this->buffer.data() + this->line_start, this->filled - this->line_start);
+      this->filled -= this->line_start;
+      this->scanned = this->filled;
+      this->line_start = 0;
+    }
+    if (this->filled == this->buffer.size()) {
+      this->buffer.resize(this->buffer.size() * 2);
+    }
+
+    const ssize_t bytes_read = read(this->fd, this->buffer.data() + this->filled, this->buffer.size() - this->filled);
+    if (bytes_read < 0 && errno == EINTR) {
+      continue;
+    }
+    if (bytes_read < 0) {
+      this->status = FileStatus::read_failed;
+      this->at_end = true;
+      return false;
+    }
+    this->filled += bytes_read;
+    this->at_end = bytes_read == 0;
+  }
+}
+
+LineSource::~LineSource() {
+  if (this->fd > STDIN_FILENO) {
+    close(this->fd);
+  }
+}
@@ -7,6 +7,7 @@
 #include <tuple>
 #include <vector>
 #include <string>
+#include <cstddef>
 
 // ReadLinesFromFile takes in the name of a file and returns two values:
 //   The first return value represents the file contents as a vector of strings
@@ -19,6 +20,108 @@ std::pair<std::vector<std::string>, int> ReadLinesFromFile(const std::string fil
 //   The second return value represents the success of the operation; negative if failure
 // Runtime complexity: linear in the length of the string
 // This is in fileutil.hpp because it is a common format for input files
+// A single-character separator is scanned with ScanSeparatedInts; longer separators are treated as a regex
 std::pair<std::vector<int>, int> ParseSeparatedInts(const std::string str, const std::string sep);
 
-#endif // FILE_UTIL_H
\ No newline at end of file
+// ScanSeparatedInts parses the ints in the characters from begin up to end, which are separated by sep, into out
+//   out is provided by the caller and has room for capacity ints; ints past that are counted but not written
+//   Spaces around each int are skipped, and a single trailing separator is allowed
+//   Returns the number of ints in the text, or a negative number if the text is not a list of ints
+// Runtime complexity: linear in the length of the text, in a single pass with no allocation
+// Digit runs are classified 16 characters at a time when SSE2 is available
+long long int ScanSeparatedInts(const char* begin, const char* end, const char sep, int* out, const std::size_t capacity);
+
+// FileStatus describes why a file could not be made available; ok if it was
+enum class FileStatus { ok=0, open_failed=1, stat_failed=2, map_failed=3, read_failed=4 };
+
+// FileStatusMessage returns a human-readable description of the given status, for printing
+const char* FileStatusMessage(const FileStatus status);
+
+// LineView is a read-only view of a single line of a MappedFile or LineSource (without its '\n')
+// It does not own its characters: it is only valid while the MappedFile it came from is alive, or until its LineSource reads the next line
+// The member names follow std::string so solvers can index lines the same way either type is used
+class LineView {
+  private:
+    const char* start;
+    std::size_t length;
+
+  public:
+    LineView(): start(NULL), length(0) {}
+    LineView(const char* s, const std::size_t len): start(s), length(len) {}
+
+    const char* data() const { return this->start; }
+    std::size_t size() const { return this->length; }
+    bool empty() const { return this->length == 0; }
+    const char* begin() const { return this->start; }
+    const char* end() const { return this->start + this->length; }
+    const char& operator[](const std::size_t i) const { return this->start[i]; }
+
+    // ToString copies the line out of the mapping, for when an owning string is really needed
+    std::string ToString() const { return std::string(this->start, this->length); }
+};
+
+// SplitLines splits the given text into views of its lines, the same way getline would split them
+// The views point into the given text, so it must outlive them; use this to parse input that is already in memory
+// Runtime complexity: linear in the length of the text, with a single allocation for the line list
+std::vector<LineView> SplitLines(const char* text, const std::size_t length);
+
+// MappedFile memory-maps a whole file read-only and splits it into LineViews pointing into the mapping
+// Lines are split the same way getline would split them, so it can stand in for ReadLinesFromFile
+// Check Status() after construction; Lines() is empty if the file could not be mapped
+// Runtime complexity: linear in the size of the file, with a single allocation for the line list
+class MappedFile {
+  private:
+    const char* contents;
+    std::size_t length;
+    std::vector<LineView> lines;
+    FileStatus status;
+
+    // the mapping is owned by exactly one object, so copying is not allowed
+    MappedFile(const MappedFile& other);
+    MappedFile& operator=(const MappedFile& other);
+
+  public:
+    explicit MappedFile(const std::string& file_name);
+
+    FileStatus Status() const { return this->status; }
+    const std::vector<LineView>& Lines() const { return this->lines; }
+    std::size_t Size() const { return this->length; }
+
+    ~MappedFile();
+};
+
+// LineSource reads lines from a file, a pipe, or standard input (named "-") front to back, a chunk at a time
+// Only the current chunk is held in memory, so memory use depends on the longest line rather than the size of the input
+// Lines are split the same way getline would split them
+// Check Status() after construction, and again once NextLine returns false, to tell the end of the input from a failed read
+class LineSource {
+  private:
+    int fd;
+    std::vector<char> buffer; // holds the line being returned, and whatever has been read after it
+    std::size_t line_start; // where the next line starts in buffer
+    std::size_t scanned; // bytes of buffer already searched for the end of the next line
+    std::size_t filled; // bytes of buffer holding input
+    bool at_end;
+    FileStatus status;
+
+    // the file descriptor is owned by exactly one object, so copying is not allowed
+    LineSource(const LineSource& other);
+    LineSource& operator=(const LineSource& other);
+
+  public:
+    static const std::size_t kChunkSize = 64 * 1024;
+
+    explicit LineSource(const std::string& file_name);
+
+    FileStatus Status() const { return this->status; }
+
+    // NextLine sets line to the next line of input, without its '\n'
+    // The view is only valid until the next call, since the buffer is reused
+    // Returns false at the end of the input, or if reading failed
+    // Runtime complexity: linear in the length of the line, amortized
+    bool NextLine(LineView& line);
+
+    ~LineSource();
+};
+
+#endif // FILE_UTIL_H
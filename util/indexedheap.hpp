@@ -0,0 +1,120 @@
+// indexedheap.hpp: Laura Galbraith
+// Description: indexed d-ary min-heap for the searches in The Advent Of Code 2021
+// The items are small integer ids (like a grid cell's index), and the heap remembers where each id sits,
+// so a queued id's key can be lowered in place instead of queueing it again and skipping the stale copy later
+
+#ifndef INDEXED_HEAP_HPP_
+#define INDEXED_HEAP_HPP_
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+// IndexedHeap is a min-heap of ids from 0 up to the id count given at construction, each queued at most once
+// Arity is the number of children per node: 4 keeps the heap shallower than a binary one, and a node's children share a cache line
+// Runtime complexity: Push, DecreaseKey, and Pop are logarithmic in the number of queued ids; memory is linear in the id count
+template <typename Key, typename Id=unsigned int, int Arity=4>
+class IndexedHeap {
+  private:
+    static const Id kNotQueued = std::numeric_limits<Id>::max();
+
+    std::vector<std::pair<Key, Id>> heap; // keys are kept next to their ids, so sifting does not look anything up
+    std::vector<Id> position; // index in heap of each id, or kNotQueued
+
+    void Place(const std::size_t i, const std::pair<Key, Id>& item) {
+      this->heap[i] = item;
+      this->position[item.second] = i;
+    }
+
+    void SiftUp(std::size_t i) {
+      const std::pair<Key, Id> item = this->heap[i];
+      while (i > 0) {
+        const std::size_t parent = (i - 1) / Arity;
+        if (!(item.first < this->heap[parent].first)) {
+          break;
+        }
+        this->Place(i, this->heap[parent]);
+        i = parent;
+      }
+      this->Place(i, item);
+    }
+
+    void SiftDown(std::size_t i) {
+      const std::pair<Key, Id> item = this->heap[i];
+      const std::size_t size = this->heap.size();
+      while (true) {
+        const std::size_t first_child = i * Arity + 1;
+        if (first_child >= size) {
+          break;
+        }
+
+        std::size_t smallest = first_child;
+        const std::size_t last_child = first_child + Arity < size ? first_child + Arity : size;
+        for (std::size_t c = first_child + 1; c < last_child; ++c) {
+          if (this->heap[c].first < this->heap[smallest].first) {
+            smallest = c;
+          }
+        }
+        if (!(this->heap[smallest].first < item.first)) {
+          break;
+        }
+        this->Place(i, this->heap[smallest]);
+        i = smallest;
+      }
+      this->Place(i, item);
+    }
+
+  public:
+    explicit IndexedHeap(const std::size_t id_count): position(id_count, kNotQueued) {}
+
+    // Grow raises the id count to the one given, for searches that number their nodes as they find them
+    void Grow(const std::size_t id_count) {
+      if (id_count > this->position.size()) {
+        this->position.resize(id_count, kNotQueued);
+      }
+    }
+
+    bool Empty() const { return this->heap.empty(); }
+    std::size_t Size() const { return this->heap.size(); }
+    bool Contains(const Id id) const { return this->position[id] != kNotQueued; }
+
+    // Top returns the id with the lowest key, and TopKey its key; the heap must not be empty
+    Id Top() const { return this->heap[0].second; }
+    const Key& TopKey() const { return this->heap[0].first; }
+
+    // PushOrDecrease queues id with the given key, or lowers its key if it is already queued with a higher one
+    void PushOrDecrease(const Id id, const Key& key) {
+      if (this->position[id] == kNotQueued) {
+        this->heap.push_back(std::pair<Key, Id>(key, id));
+        this->SiftUp(this->heap.size() - 1);
+        return;
+      }
+
+      const std::size_t i = this->position[id];
+      if (key < this->heap[i].first) {
+        this->heap[i].first = key;
+        this->SiftUp(i);
+      }
+    }
+
+    // Pop removes and returns the id with the lowest key; the heap must not be empty
+    Id Pop() {
+      const Id top = this->heap[0].second;
+      this->position[top] = kNotQueued;
+
+      const std::pair<Key, Id> last = this->heap.back();
+      this->heap.pop_back();
+      if (!this->heap.empty()) {
+        this->heap[0] = last;
+        this->SiftDown(0);
+      }
+      return top;
+    }
+};
+
+// kNotQueued is passed by reference to vector's fill functions, so it needs a definition
+template <typename Key, typename Id, int Arity>
+const Id IndexedHeap<Key, Id, Arity>::kNotQueued;
+
+#endif // INDEXED_HEAP_HPP_
@@ -0,0 +1,148 @@
+// instrument.cpp: Laura Galbraith
+// Description: registry and report for the instrumentation of the solvers for The Advent Of Code 2021
+
+#include "instrument.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstring>
+
+using namespace std;
+
+namespace instrument {
+
+Metric::Metric(const char* n, const MetricKind k): name(n), kind(k), count(0), total(0), max(0) {
+  for (int b = 0; b < Metric::kBuckets; ++b) {
+    this->buckets[b].store(0);
+  }
+}
+
+// BucketFor returns the histogram bucket that value is counted in: the number of bits needed to write it
+int BucketFor(unsigned long long int value) {
+  int bucket = 0;
+  while (value > 0) {
+    value >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+// Relaxed ordering is enough: the values are only read for the report, once the recording threads are done
+void Metric::Record(const unsigned long long int value) {
+  this->count.fetch_add(1, memory_order_relaxed);
+  this->total.fetch_add(value, memory_order_relaxed);
+  if (this->kind != MetricKind::counter) {
+    this->buckets[BucketFor(value)].fetch_add(1, memory_order_relaxed);
+  }
+
+  unsigned long long int seen_max = this->max.load(memory_order_relaxed);
+  while (value > seen_max && !this->max.compare_exchange_weak(seen_max, value, memory_order_relaxed)) {}
+}
+
+void Metric::Reset() {
+  this->count.store(0);
+  this->total.store(0);
+  this->max.store(0);
+  for (int b = 0; b < Metric::kBuckets; ++b) {
+    this->buckets[b].store(0);
+  }
+}
+
+// The registry is only locked when a metric is first looked up, since each use of the macros keeps its metric after that
+mutex registry_lock;
+vector<Metric*>& Registry() {
+  static vector<Metric*>* metrics = new vector<Metric*>(); // never freed, so metrics stay valid during static destruction
+  return *metrics;
+}
+
+Metric* FindOrAddMetric(const char* name, const MetricKind kind) {
+  lock_guard<mutex> guard(registry_lock);
+  for (auto m:Registry()) {
+    if (strcmp(m->name, name) == 0) {
+      return m;
+    }
+  }
+
+  Metric* m = new Metric(name, kind);
+  Registry().push_back(m);
+  return m;
+}
+
+bool Enabled() {
+#ifdef AOC_INSTRUMENT
+  return true;
+#else
+  return false;
+#endif
+}
+
+void Reset() {
+  lock_guard<mutex> guard(registry_lock);
+  for (auto m:Registry()) {
+    m->Reset();
+  }
+}
+
+// BucketPercentile returns an upper bound on the given percentile of the values in the metric's histogram
+unsigned long long int BucketPercentile(const Metric& m, const double p) {
+  const unsigned long long int count = m.count.load();
+  const unsigned long long int rank = (unsigned long long int)(p / 100.0 * count + 0.999999);
+  unsigned long long int seen = 0;
+  for (int b = 0; b < Metric::kBuckets; ++b) {
+    seen += m.buckets[b].load();
+    if (seen >= rank && seen > 0) {
+      // the bucket's largest value, but never more than the largest value recorded
+      unsigned long long int bucket_max = b == 0 ? 0 : (b >= 64 ? ~0ULL : (1ULL << b) - 1);
+      return min(bucket_max, m.max.load());
+    }
+  }
+  return m.max.load();
+}
+
+// Timers are reported in microseconds; the other kinds are reported in their own units
+double ReportedValue(const Metric& m, const double value) {
+  return m.kind == MetricKind::timer ? value / 1000.0 : value;
+}
+
+void Report(ostream& os) {
+  vector<Metric*> metrics;
+  {
+    lock_guard<mutex> guard(registry_lock);
+    for (auto m:Registry()) {
+      if (m->count.load() > 0) {
+        metrics.push_back(m);
+      }
+    }
+  }
+  if (metrics.empty()) {
+    os << "(no metrics recorded)" << endl;
+    return;
+  }
+
+  sort(metrics.begin(), metrics.end(), [](const Metric* a, const Metric* b) { return strcmp(a->name, b->name) < 0; });
+
+  const char* kind_names[] = { "timer us", "counter", "histogram" };
+  os << left << setw(36) << "metric" << setw(11) << "kind" << right
+    << setw(12) << "count" << setw(16) << "total" << setw(14) << "mean"
+    << setw(12) << "p50<=" << setw(12) << "p99<=" << setw(14) << "max" << endl;
+
+  for (auto m:metrics) {
+    const unsigned long long int count = m->count.load();
+    const double total = m->total.load();
+    os << left << setw(36) << m->name << setw(11) << kind_names[(int)m->kind] << right << fixed << setprecision(1)
+      << setw(12) << count;
+    if (m->kind == MetricKind::counter) {
+      os << setw(16) << m->total.load() << endl; // a counter's total is all there is to it
+      continue;
+    }
+
+    os << setw(16) << ReportedValue(*m, total) << setw(14) << ReportedValue(*m, total / count)
+      << setw(12) << ReportedValue(*m, BucketPercentile(*m, 50))
+      << setw(12) << ReportedValue(*m, BucketPercentile(*m, 99))
+      << setw(14) << ReportedValue(*m, m->max.load()) << endl;
+  }
+}
+
+} // namespace instrument
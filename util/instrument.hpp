@@ -0,0 +1,109 @@
+// instrument.hpp: Laura Galbraith
+// Description: lightweight instrumentation of the solvers' hot loops for The Advent Of Code 2021: scoped timers, named counters, and histograms
+// The macros below compile to nothing unless AOC_INSTRUMENT is defined (the 'instrument' configuration in the Makefile defines it)
+// Usage, inside a function:
+//   AOC_TIME_SCOPE("day15.astar");                       times from here to the end of the enclosing scope
+//   AOC_COUNT("day15.astar.expansions", 1);              adds to a running total
+//   AOC_HISTOGRAM("day15.astar.open_set", open_set.size()); records one value, to see how the values are spread
+// Names are string literals; each use looks up its metric the first time it runs, so a metric costs a few atomic adds after that
+// The same name used in several places shares one metric, so name them "dayNN.what"
+
+#ifndef INSTRUMENT_HPP_
+#define INSTRUMENT_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <ostream>
+
+namespace instrument {
+
+enum class MetricKind { timer=0, counter=1, histogram=2 };
+
+// Metric accumulates every value recorded under one name; it may be recorded to from several threads at once
+// Timers record nanoseconds per scope; counters record the amount added each time
+class Metric {
+  public:
+    // Bucket b counts values v with 2^(b-1) <= v < 2^b, and bucket 0 counts zeros
+    static const int kBuckets = 65;
+
+    const char* name;
+    const MetricKind kind;
+    std::atomic<unsigned long long int> count; // number of values recorded
+    std::atomic<unsigned long long int> total;
+    std::atomic<unsigned long long int> max;
+    std::atomic<unsigned long long int> buckets[kBuckets];
+
+    Metric(const char* n, const MetricKind k);
+
+    void Record(const unsigned long long int value);
+
+    // Reset zeros everything recorded; it should not race with Record
+    void Reset();
+
+  private:
+    Metric(const Metric& other);
+    Metric& operator=(const Metric& other);
+};
+
+// FindOrAddMetric returns the metric with the given name, adding it the first time the name is seen
+// The metric lives until the program exits; a name asked for with a different kind keeps its first kind
+Metric* FindOrAddMetric(const char* name, const MetricKind kind);
+
+// Enabled is true when the library was built with AOC_INSTRUMENT, so there is something to report
+bool Enabled();
+
+// Reset zeros every metric, for example between the days of a benchmark
+void Reset();
+
+// Report prints every metric that has recorded anything, sorted by name, as a table
+// Runtime complexity: linear in the number of metrics
+void Report(std::ostream& os);
+
+// ScopedTimer records the time from its construction to its destruction in metric
+class ScopedTimer {
+  private:
+    Metric* metric;
+    std::chrono::steady_clock::time_point start;
+
+    ScopedTimer(const ScopedTimer& other);
+    ScopedTimer& operator=(const ScopedTimer& other);
+
+  public:
+    explicit ScopedTimer(Metric* m): metric(m), start(std::chrono::steady_clock::now()) {}
+
+    ~ScopedTimer() {
+      std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - this->start;
+      this->metric->Record(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+};
+
+} // namespace instrument
+
+#ifdef AOC_INSTRUMENT
+
+#define AOC_INSTRUMENT_JOIN_(a, b) a##b
+#define AOC_INSTRUMENT_JOIN(a, b) AOC_INSTRUMENT_JOIN_(a, b)
+
+#define AOC_TIME_SCOPE(name) \
+  static instrument::Metric* const AOC_INSTRUMENT_JOIN(aoc_timer_metric_, __LINE__) = instrument::FindOrAddMetric(name, instrument::MetricKind::timer); \
+  instrument::ScopedTimer AOC_INSTRUMENT_JOIN(aoc_timer_, __LINE__)(AOC_INSTRUMENT_JOIN(aoc_timer_metric_, __LINE__))
+
+#define AOC_COUNT(name, amount) do { \
+    static instrument::Metric* const aoc_metric = instrument::FindOrAddMetric(name, instrument::MetricKind::counter); \
+    aoc_metric->Record(amount); \
+  } while (0)
+
+#define AOC_HISTOGRAM(name, value) do { \
+    static instrument::Metric* const aoc_metric = instrument::FindOrAddMetric(name, instrument::MetricKind::histogram); \
+    aoc_metric->Record(value); \
+  } while (0)
+
+#else
+
+#define AOC_TIME_SCOPE(name) do {} while (0)
+#define AOC_COUNT(name, amount) do {} while (0)
+#define AOC_HISTOGRAM(name, value) do {} while (0)
+
+#endif // AOC_INSTRUMENT
+
+#endif // INSTRUMENT_HPP_
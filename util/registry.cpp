@@ -0,0 +1,78 @@
+// registry.cpp: Laura Galbraith
+// Description: list of the solvers for every day of The Advent Of Code 2021
+
+#include "registry.hpp"
+#include "../day01/solver.hpp"
+#include "../day02/solver.hpp"
+#include "../day03/solver.hpp"
+#include "../day04/solver.hpp"
+#include "../day05/solver.hpp"
+#include "../day06/solver.hpp"
+#include "../day07/solver.hpp"
+#include "../day08/solver.hpp"
+#include "../day09/solver.hpp"
+#include "../day10/solver.hpp"
+#include "../day11/solver.hpp"
+#include "../day12/solver.hpp"
+#include "../day13/solver.hpp"
+#include "../day14/solver.hpp"
+#include "../day15/solver.hpp"
+#include "../day16/solver.hpp"
+#include "../day17/solver.hpp"
+#include "../day18/solver.hpp"
+#include "../day19/solver.hpp"
+#include "../day20/solver.hpp"
+#include "../day21/solver.hpp"
+#include "../day22/solver.hpp"
+#include "../day23/solver.hpp"
+#include "../day24/solver.hpp"
+#include "../day25/solver.hpp"
+#include <string>
+#include <vector>
+
+using namespace std;
+
+template <typename DaySolver>
+PuzzleSolver* CreateSolver() {
+  return new DaySolver();
+}
+
+const vector<SolverEntry>& AllSolvers() {
+  static const vector<SolverEntry> solvers = {
+    {"day01", "day01/input.txt", CreateSolver<day01::Day01Solver>, false},
+    {"day02", "day02/input.txt", CreateSolver<day02::Day02Solver>, false},
+    {"day03", "day03/input.txt", CreateSolver<day03::Day03Solver>, false},
+    {"day04", "day04/input.txt", CreateSolver<day04::Day04Solver>, false},
+    {"day05", "day05/input.txt", CreateSolver<day05::Day05Solver>, false},
+    {"day06", "day06/input.txt", CreateSolver<day06::Day06Solver>, false},
+    {"day07", "day07/input.txt", CreateSolver<day07::Day07Solver>, false},
+    {"day08", "day08/input.txt", CreateSolver<day08::Day08Solver>, false},
+    {"day09", "day09/input.txt", CreateSolver<day09::Day09Solver>, false},
+    {"day10", "day10/input.txt", CreateSolver<day10::Day10Solver>, false},
+    {"day11", "day11/input.txt", CreateSolver<day11::Day11Solver>, false},
+    {"day12", "day12/input.txt", CreateSolver<day12::Day12Solver>, false},
+    {"day13", "day13/input.txt", CreateSolver<day13::Day13Solver>, false},
+    {"day14", "day14/input.txt", CreateSolver<day14::Day14Solver>, false},
+    {"day15", "day15/input.txt", CreateSolver<day15::Day15Solver>, false},
+    {"day16", "day16/input.txt", CreateSolver<day16::Day16Solver>, false},
+    {"day17", "day17/input.txt", CreateSolver<day17::Day17Solver>, false},
+    {"day18", "day18/input.txt", CreateSolver<day18::Day18Solver>, false},
+    {"day19", "day19/input.txt", CreateSolver<day19::Day19Solver>, true},
+    {"day20", "day20/input.txt", CreateSolver<day20::Day20Solver>, false},
+    {"day21", "day21/input.txt", CreateSolver<day21::Day21Solver>, false},
+    {"day22", "day22/input.txt", CreateSolver<day22::Day22Solver>, false},
+    {"day23", "day23/input.txt", CreateSolver<day23::Day23Solver>, false},
+    {"day24", "day24/input.txt", CreateSolver<day24::Day24Solver>, false},
+    {"day25", "day25/input.txt", CreateSolver<day25::Day25Solver>, false},
+  };
+  return solvers;
+}
+
+const SolverEntry* FindSolver(const string& name) {
+  for (const SolverEntry& entry:AllSolvers()) {
+    if (name == entry.name) {
+      return &entry;
+    }
+  }
+  return NULL;
+}
@@ -0,0 +1,29 @@
+// registry.hpp: Laura Galbraith
+// Description: list of the solvers for every day of The Advent Of Code 2021, for programs that run many days in-process
+
+#ifndef REGISTRY_HPP_
+#define REGISTRY_HPP_
+
+#include "solver.hpp" // PuzzleSolver
+#include <string>
+#include <vector>
+
+// SolverEntry describes how to run one day's solver
+//   name is the day, like "day15"
+//   default_input_file is the input the day's program reads when given no file, relative to the repo root
+//   create returns a new solver, which the caller must delete
+//   slow is true for days that take many seconds even with optimizations on
+struct SolverEntry {
+  const char* name;
+  const char* default_input_file;
+  PuzzleSolver* (*create)();
+  bool slow;
+};
+
+// AllSolvers returns every day's solver, in day order
+const std::vector<SolverEntry>& AllSolvers();
+
+// FindSolver returns the entry for the given day name, or NULL if there is none
+const SolverEntry* FindSolver(const std::string& name);
+
+#endif // REGISTRY_HPP_
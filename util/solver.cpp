@@ -0,0 +1,123 @@
+// solver.cpp: Laura Galbraith
+// Description: shared program body for the solvers for each day of The Advent Of Code 2021
+
+#include "solver.hpp"
+#include "fileutil.hpp" // MappedFile, LineSource, SplitLines
+#include "instrument.hpp" // AOC_TIME_SCOPE, Report
+#include "allocprof.hpp" // ScopedPhase, Report
+#include <iostream>
+#include <stdexcept>
+
+using namespace std;
+
+// PrintAnswer prints the answer on the same line as its label, unless it spans several lines (like Day 13's letters)
+void PrintAnswer(const int part, const string& answer) {
+  cout << "Part " << part << " answer:";
+  if (answer.find('\n') != string::npos) {
+    cout << endl << answer << endl;
+  }
+  else {
+    cout << " " << answer << endl;
+  }
+}
+
+void ThrowIfReadFailed(const LineSource& source) {
+  if (source.Status() != FileStatus::ok) {
+    throw runtime_error(string("reading input failed: ") + FileStatusMessage(source.Status()));
+  }
+}
+
+// The default gathers every line, so that Parse sees them all at once, like it would from a MappedFile
+void PuzzleSolver::ParseStream(LineSource& source) {
+  string text;
+  LineView line;
+  while (source.NextLine(line)) {
+    text.append(line.data(), line.size());
+    text.push_back('\n');
+  }
+  ThrowIfReadFailed(source);
+
+  this->Parse(SplitLines(text.data(), text.size()));
+}
+
+// SolveParsed prints the answers to the parts asked for, once the solver has parsed its input
+void SolveParsed(PuzzleSolver& solver, const int only_part) {
+  if (only_part == 0 || only_part == 1) {
+    AOC_TIME_SCOPE("solver.part1");
+    allocprof::ScopedPhase phase(allocprof::Phase::part1);
+    PrintAnswer(1, solver.Part1());
+  }
+  if ((only_part == 0 && solver.PartCount() > 1) || only_part == 2) {
+    AOC_TIME_SCOPE("solver.part2");
+    allocprof::ScopedPhase phase(allocprof::Phase::part2);
+    PrintAnswer(2, solver.Part2());
+  }
+}
+
+// ReportInstrumentation prints what the instrumented or allocation-profiled build measured,
+// on standard error so the answers can still be piped on their own
+void ReportInstrumentation(const string& input_file) {
+  if (instrument::Enabled()) {
+    cerr << "Instrumentation report for " << input_file << ":" << endl;
+    instrument::Report(cerr);
+  }
+  if (allocprof::Enabled()) {
+    cerr << "Allocation profile for " << input_file << ":" << endl;
+    allocprof::Report(cerr);
+  }
+}
+
+// ParseStreamTimed and ParseTimed parse the input under the same timer, however it is read
+void ParseStreamTimed(PuzzleSolver& solver, LineSource& source) {
+  AOC_TIME_SCOPE("solver.parse");
+  allocprof::ScopedPhase phase(allocprof::Phase::parse);
+  solver.ParseStream(source);
+}
+
+void ParseTimed(PuzzleSolver& solver, const vector<LineView>& lines) {
+  AOC_TIME_SCOPE("solver.parse");
+  allocprof::ScopedPhase phase(allocprof::Phase::parse);
+  solver.Parse(lines);
+}
+
+int RunSolverMain(PuzzleSolver& solver, const string& default_input_file, int argc, char** argv, const int only_part) {
+  const string input_file = argc > 1 ? argv[1] : default_input_file;
+
+  // Memory-mapping is fastest when the whole input is needed anyway, but standard input cannot be mapped
+  if (input_file == "-" || solver.Streams()) {
+    LineSource source(input_file);
+    if (source.Status() != FileStatus::ok) {
+      cout << "Failed to read file: " << FileStatusMessage(source.Status()) << endl;
+      return -1;
+    }
+
+    try {
+      ParseStreamTimed(solver, source);
+      SolveParsed(solver, only_part);
+    }
+    catch (const exception& e) {
+      cout << "Failed to solve " << input_file << ": " << e.what() << endl;
+      return -1;
+    }
+    ReportInstrumentation(input_file);
+    return 0;
+  }
+
+  MappedFile file(input_file);
+  if (file.Status() != FileStatus::ok) {
+    cout << "Failed to read file: " << FileStatusMessage(file.Status()) << endl;
+    return -1;
+  }
+
+  try {
+    ParseTimed(solver, file.Lines());
+    SolveParsed(solver, only_part);
+  }
+  catch (const exception& e) {
+    cout << "Failed to solve " << input_file << ": " << e.what() << endl;
+    return -1;
+  }
+
+  ReportInstrumentation(input_file);
+  return 0;
+}
@@ -0,0 +1,100 @@
+// solver.hpp: Laura Galbraith
+// Description: common interface for the solvers for each day of The Advent Of Code 2021
+// Each solver parses its puzzle input once, then answers Part 1 and Part 2 from the parsed input
+// This lets the solvers be driven by the per-day programs, the benchmark harness, or any other caller in-process
+
+#ifndef SOLVER_HPP_
+#define SOLVER_HPP_
+
+#include "fileutil.hpp" // LineView, LineSource
+#include <string>
+#include <vector>
+#include <sstream>
+
+// PuzzleSolver is the type-erased interface to a day's solver, with answers formatted as strings
+// Expected call order is Parse (or ParseStream), then Part1 and/or Part2; a solver is good for one input
+// Parse throws std::invalid_argument if the input is not in the expected format,
+// and the parts throw std::logic_error if they fail to find an answer
+class PuzzleSolver {
+  public:
+    virtual ~PuzzleSolver() {}
+
+    virtual void Parse(const std::vector<LineView>& lines) = 0;
+    virtual std::string Part1() = 0;
+    virtual std::string Part2() = 0;
+
+    // PartCount is the number of parts the day's puzzle has; Part2 should not be called if this is 1
+    virtual int PartCount() const { return 2; }
+
+    // Part2DependsOnPart1 is true when Part 2 continues from Part 1's work or modifies the same parsed input
+    // Part2 still gives the right answer if called on its own (it runs Part 1 first), but the parts must not run concurrently
+    virtual bool Part2DependsOnPart1() const { return false; }
+
+    // ParseStream parses the lines read from source, in place of Parse
+    // By default the whole input is read into memory first; days that can parse one line at a time do not need to (see StreamingSolver)
+    // Also throws std::runtime_error if reading fails
+    virtual void ParseStream(LineSource& source);
+
+    // Streams is true when ParseStream's memory use does not grow with the size of the input
+    virtual bool Streams() const { return false; }
+};
+
+// AnswerString formats an answer the way the per-day programs print it
+template <typename Answer>
+std::string AnswerString(const Answer& answer) {
+  std::ostringstream os;
+  os << answer;
+  return os.str();
+}
+
+// Solver is the typed interface to a day's solver; days derive from this with their answer types
+template <typename Part1Answer, typename Part2Answer>
+class Solver : public PuzzleSolver {
+  public:
+    virtual ~Solver() {}
+
+    virtual Part1Answer SolvePart1() = 0;
+    virtual Part2Answer SolvePart2() = 0;
+
+    std::string Part1() { return AnswerString(this->SolvePart1()); }
+    std::string Part2() { return AnswerString(this->SolvePart2()); }
+};
+
+// ThrowIfReadFailed throws std::runtime_error if source stopped because reading failed, rather than at the end of the input
+void ThrowIfReadFailed(const LineSource& source);
+
+// StreamingSolver is for days whose input can be parsed one line at a time, in a single forward pass
+// The answers are worked out as each line arrives, so a stream never has to be held in memory
+template <typename Part1Answer, typename Part2Answer>
+class StreamingSolver : public Solver<Part1Answer, Part2Answer> {
+  public:
+    virtual ~StreamingSolver() {}
+
+    // ParseLine parses the next line of input; the view is only valid during the call
+    virtual void ParseLine(const LineView& line) = 0;
+
+    void Parse(const std::vector<LineView>& lines) {
+      for (auto& line:lines) {
+        this->ParseLine(line);
+      }
+    }
+
+    void ParseStream(LineSource& source) {
+      LineView line;
+      while (source.NextLine(line)) {
+        this->ParseLine(line);
+      }
+      ThrowIfReadFailed(source);
+    }
+
+    bool Streams() const { return true; }
+};
+
+// RunSolverMain is the body of each day's program: it solves the input file named on the command line,
+// or default_input_file if none is given, and prints the answers
+// An input file of "-" is read from standard input; that, and days whose solvers stream, read the input a chunk at a time
+// only_part can be 1 or 2 to print just that part's answer; 0 prints all parts
+// Returns 0 on success, or -1 if the file could not be read or the solver failed
+int RunSolverMain(PuzzleSolver& solver, const std::string& default_input_file, int argc, char** argv, const int only_part=0);
+
+#endif // SOLVER_HPP_
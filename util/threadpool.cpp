@@ -0,0 +1,143 @@
+// threadpool.cpp: Laura Galbraith
+// Description: work-stealing thread pool for running independent pieces of work for The Advent Of Code 2021 in parallel
+
+#include "threadpool.hpp"
+
+using namespace std;
+
+// Each worker thread remembers which pool it belongs to and its index, so tasks it submits can go on its own queue
+static thread_local const ThreadPool* current_pool = NULL;
+static thread_local int current_worker = -1;
+
+ThreadPool::ThreadPool(const unsigned int thread_count): queued(0), unfinished(0), stopping(false), next_queue(0) {
+  unsigned int count = thread_count;
+  if (count == 0) {
+    count = thread::hardware_concurrency();
+  }
+  if (count == 0) {
+    count = 1; // the number of hardware threads is not always known
+  }
+
+  for (unsigned int i = 0; i < count; ++i) {
+    this->queues.push_back(new WorkerQueue());
+  }
+  for (unsigned int i = 0; i < count; ++i) {
+    this->threads.push_back(thread(&ThreadPool::WorkerLoop, this, i));
+  }
+}
+
+int ThreadPool::CurrentWorker() const {
+  return current_pool == this ? current_worker : -1;
+}
+
+void ThreadPool::Submit(const Task& task) {
+  int worker = this->CurrentWorker();
+  const bool from_worker = worker >= 0;
+  if (!from_worker) {
+    worker = this->next_queue.fetch_add(1) % this->queues.size();
+  }
+
+  // Count the task before it is queued, so the counts never fall behind what workers can see
+  {
+    lock_guard<mutex> state_guard(this->state_lock);
+    ++this->queued;
+    ++this->unfinished;
+  }
+
+  // The back of each queue is what runs next
+  {
+    lock_guard<mutex> queue_guard(this->queues[worker]->lock);
+    if (from_worker) {
+      this->queues[worker]->tasks.push_back(task);
+    }
+    else {
+      this->queues[worker]->tasks.push_front(task);
+    }
+  }
+  this->work_available.notify_one();
+}
+
+// TakeTask takes the worker's next task from the back of its queue, or else steals from the front of the next worker's queue that has one
+// Stealing from the other end keeps thieves from taking the follow-up work a worker queued for itself, and leaves the worker's newest tasks to it
+// Returns false if every queue was empty when checked
+bool ThreadPool::TakeTask(const int worker, Task& task) {
+  {
+    WorkerQueue* own = this->queues[worker];
+    lock_guard<mutex> queue_guard(own->lock);
+    if (!own->tasks.empty()) {
+      task = own->tasks.back();
+      own->tasks.pop_back();
+      return true;
+    }
+  }
+
+  for (unsigned int i = 1; i < this->queues.size(); ++i) {
+    WorkerQueue* victim = this->queues[(worker + i) % this->queues.size()];
+    lock_guard<mutex> queue_guard(victim->lock);
+    if (!victim->tasks.empty()) {
+      task = victim->tasks.front();
+      victim->tasks.pop_front();
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void ThreadPool::WorkerLoop(const int worker) {
+  current_pool = this;
+  current_worker = worker;
+
+  while (true) {
+    {
+      // Sleep until there is something queued somewhere (or the pool is stopping)
+      unique_lock<mutex> state_guard(this->state_lock);
+      this->work_available.wait(state_guard, [this] { return this->stopping || this->queued > 0; });
+      if (this->queued == 0) {
+        return; // stopping, and nothing is left to do
+      }
+    }
+
+    Task task;
+    if (!this->TakeTask(worker, task)) {
+      continue; // another worker got there first, or the task is counted but not queued yet
+    }
+
+    {
+      lock_guard<mutex> state_guard(this->state_lock);
+      --this->queued;
+    }
+
+    task();
+
+    bool finished_all;
+    {
+      lock_guard<mutex> state_guard(this->state_lock);
+      --this->unfinished;
+      finished_all = this->unfinished == 0;
+    }
+    if (finished_all) {
+      this->all_done.notify_all();
+    }
+  }
+}
+
+void ThreadPool::Wait() {
+  unique_lock<mutex> state_guard(this->state_lock);
+  this->all_done.wait(state_guard, [this] { return this->unfinished == 0; });
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    lock_guard<mutex> state_guard(this->state_lock);
+    this->stopping = true;
+  }
+  this->work_available.notify_all();
+
+  for (auto& t:this->threads) {
+    t.join();
+  }
+  for (auto q:this->queues) {
+    delete q;
+  }
+}
@@ -0,0 +1,67 @@
+// threadpool.hpp: Laura Galbraith
+// Description: work-stealing thread pool for running independent pieces of work for The Advent Of Code 2021 in parallel
+
+#ifndef THREAD_POOL_HPP_
+#define THREAD_POOL_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ThreadPool runs submitted tasks on a fixed set of worker threads
+// Each worker has its own queue of tasks, run from the back, and when it runs out, it steals from the front of another worker's queue
+// Tasks may submit more tasks (for example, work that depends on them); those go on the submitting worker's own queue,
+// ahead of everything already there, so follow-up work runs next and stays on the same thread unless it is stolen
+// Tasks submitted from outside the pool are spread across the workers in turn, and start in submission order,
+// so submit the longest tasks first
+class ThreadPool {
+  public:
+    typedef std::function<void()> Task;
+
+    // thread_count of 0 uses one worker per hardware thread
+    explicit ThreadPool(const unsigned int thread_count=0);
+
+    void Submit(const Task& task);
+
+    // Wait blocks until every submitted task, including tasks submitted by tasks, has finished
+    void Wait();
+
+    unsigned int ThreadCount() const { return this->threads.size(); }
+
+    // CurrentWorker returns the index of the worker running the caller, or -1 if the caller is not one of this pool's workers
+    int CurrentWorker() const;
+
+    // Stops the workers once the tasks already submitted have finished
+    ~ThreadPool();
+
+  private:
+    class WorkerQueue {
+      public:
+        std::mutex lock;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<WorkerQueue*> queues; // indexed by worker
+    std::vector<std::thread> threads;
+
+    std::mutex state_lock; // guards sleeping and waking
+    std::condition_variable work_available;
+    std::condition_variable all_done;
+    int queued; // tasks sitting in queues; only changed under state_lock
+    long long int unfinished; // tasks submitted but not finished; only changed under state_lock
+    bool stopping;
+    std::atomic<unsigned int> next_queue; // round-robin target for submissions from outside the pool
+
+    bool TakeTask(const int worker, Task& task);
+    void WorkerLoop(const int worker);
+
+    // the workers hold a pointer to the pool, so it cannot be copied
+    ThreadPool(const ThreadPool& other);
+    ThreadPool& operator=(const ThreadPool& other);
+};
+
+#endif // THREAD_POOL_HPP_